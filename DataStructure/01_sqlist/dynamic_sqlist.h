@@ -2,6 +2,12 @@
 #define DYNAMIC_SQLIST_H
 #include <iterator>
 #include <initializer_list>
+#include "sqlist_sort.h"
+#include "sqlist_move.h"
+#include "sqlist_span.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
 
 template <typename T>
 class DynamicSqlist
@@ -9,7 +15,7 @@ class DynamicSqlist
 public:
     // 构造函数
     DynamicSqlist() = default;
-    DynamicSqlist(int capacity) : capacity_(capacity), size_(0), data_(new T[capacity]) {}
+    DynamicSqlist(int capacity) : data_(new T[capacity]), capacity_(capacity), size_(0) {}
     DynamicSqlist(std::initializer_list<T> init)
     {
         for (const auto & item : init)
@@ -31,7 +37,7 @@ public:
     void push_front(U&& x)
     {
         if (size_ >= capacity_) resize();
-        for(int i = size_; i > 0; i--) data_[i] = std::move(data_[i - 1]);
+        sqlist_move::shift(data_, data_ + size_, data_ + 1);
         data_[0] = std::forward<U>(x);
         size_++;
     }
@@ -41,7 +47,7 @@ public:
     {
         if (index < 0 || index > size_) return;
         if (size_ >= capacity_) resize();
-        for(int i = size_; i > index; i--) data_[i] = std::move(data_[i - 1]);
+        sqlist_move::shift(data_ + index, data_ + size_, data_ + index + 1);
         data_[index] = std::forward<U>(x);
         size_++;
     }
@@ -57,14 +63,14 @@ public:
     void pop_front()
     {
         if (size_ <= 0) return;
-        for (int i = 1; i < size_; i++) data_[i - 1] = std::move(data_[i]);
+        sqlist_move::shift(data_ + 1, data_ + size_, data_);
         size_--;
     }
     // 任意位置删除 O(N)
     void erase(int index)
     {
         if (size_ <= 0 || index < 0 || index >= size_) return;
-        for (int i = index + 1; i < size_; i++) data_[i - 1] = std::move(data_[i]);
+        sqlist_move::shift(data_ + index + 1, data_ + size_, data_ + index);
         size_--;
     }
     void remove(int index) { erase(index); }
@@ -93,7 +99,7 @@ public:
         if (index < 0 || index >= size_) throw std::out_of_range("Index out of bounds");
         return data_[index];
     }
-    const T& at(int index) const 
+    const T& at(int index) const
     {
         if (index < 0 || index >= size_) throw std::out_of_range("Index out of bounds");
         return data_[index];
@@ -126,9 +132,17 @@ public:
         if (index < 0 || index > size_) return false;
         int len = std::distance(first, last);
         if (len <= 0) return false;
-        while(capacity_ < size_ + len) resize();
+        // 来源是自己的元素（如 a.insert_range(0, a.span())）时，扩容会释放它、搬移会覆盖它，先拷贝一份
+        if (overlaps(first, last))
+        {
+            DynamicSqlist temp;
+            temp.insert_range(0, first, last);
+            return insert_range(index, temp.begin(), temp.end());
+        }
+        // 一次预留到位，至多扩容一次；仍按倍增取容量，反复小批量插入时均摊 O(1)
+        if (capacity_ < size_ + len) reserve(std::max(size_ + len, capacity_ * 2));
         // for (int i = size_ - 1; i >= index; i--) data_[i + len] = std::move(data_[i]);
-        if (index < size_) std::copy_backward(data_ + index, data_ + size_, data_ + size_ + len);
+        sqlist_move::shift(data_ + index, data_ + size_, data_ + index + len);
         std::copy(first, last, data_ + index);
         size_ += len;
         return true;
@@ -136,26 +150,44 @@ public:
     bool insert_range(int index, std::initializer_list<T> init) { return insert_range(index, init.begin(), init.end()); }
     bool insert_range(int index, const DynamicSqlist& other) { return insert_range(index, other.begin(), other.end()); }
     bool insert_range(int index, const T* arr, int len) { return insert_range(index, arr, arr + len); }
+    bool insert_range(int index, SqlistSpan<const T> span) { return insert_range(index, span.begin(), span.end()); }
     // 批量添加
+    // 前向迭代器可预先求长度，整段插入，至多扩容一次；输入迭代器逐个尾插
     template<typename InputIt>
     void append(InputIt first, InputIt last)
     {
-        for (auto it = first; it != last; ++it) push_back(*it);
+        append(first, last, typename std::iterator_traits<InputIt>::iterator_category());
     }
     void append(std::initializer_list<T> init) { append(init.begin(), init.end()); }
     void append(const DynamicSqlist& other) { append(other.begin(), other.end()); }
     void append(const T* arr, int len) { append(arr, arr + len); }
+    // 整段拷贝（可平凡复制类型为一次 memcpy），至多扩容一次
+    void append(SqlistSpan<const T> span) { insert_range(size_, span.begin(), span.end()); }
     // 批量删除
     bool erase_range(int index, int len = -1)
     {
         if (len == -1) len = size_ - index;
         if (index < 0 || index >= size_ || len <= 0 || index + len > size_) return false;
-        for (int i = index + len; i < size_; i++) data_[i - len] = std::move(data_[i]);
+        sqlist_move::shift(data_ + index + len, data_ + size_, data_ + index);
         size_ -= len;
         return true;
     }
     bool remove_range(int index, int len) { return erase_range(index, len); }
 
+    // 排序，默认升序
+    // 整数 / 浮点使用基数排序 O(N)，其余类型使用内省排序 O(N log N)
+    void sort() { sqlist_sort::sort(begin(), end()); }
+    template<typename Compare>
+    void sort(Compare comp) { sqlist_sort::sort(begin(), end(), comp); }
+    // 稳定排序
+    void stable_sort() { sqlist_sort::stable_sort(begin(), end()); }
+    template<typename Compare>
+    void stable_sort(Compare comp) { sqlist_sort::stable_sort(begin(), end(), comp); }
+    // 多线程稳定排序，适合超大顺序表，threads <= 0 时使用硬件线程数
+    void parallel_sort(int threads = 0) { sqlist_sort::parallel_sort(begin(), end(), threads); }
+    template<typename Compare>
+    void parallel_sort(Compare comp, int threads = 0) { sqlist_sort::parallel_sort(begin(), end(), comp, threads); }
+
     // 清空操作
     void clear()
     {
@@ -166,10 +198,47 @@ public:
     }
 
     // 容量相关
+    // 预留容量 O(N)，容量足够时不做任何事
+    void reserve(int new_capacity)
+    {
+        if (new_capacity <= capacity_) return;
+        T *newData = new T[new_capacity];
+        std::move(data_, data_ + size_, newData);
+        delete[] data_;
+        data_ = newData;
+        capacity_ = new_capacity;
+    }
     int capacity() const noexcept { return capacity_; }
     int size() const noexcept { return size_; }
     bool empty() const noexcept { return size_ == 0; }
 
+    // 缓冲区所有权
+    // 接管一块 new T[capacity] 分配的数组，前 size 个为有效元素，原有内容被释放 O(1)
+    // 参数不合法或 data 就是顺序表自己的数组（接管前会被释放）时返回 false，顺序表保持不变
+    bool adopt(T* data, int size, int capacity)
+    {
+        if (size < 0 || capacity < size || (data == nullptr && capacity != 0)) return false;
+        if (data != nullptr && data == data_) return false;
+        clear();
+        data_ = data;
+        size_ = size;
+        capacity_ = capacity;
+        return true;
+    }
+    // 交出内部数组的所有权，调用者负责 delete[]，顺序表变为空 O(1)
+    // 需要长度和容量时请在调用前通过 size() / capacity() 取得
+    T* release()
+    {
+        T* data = data_;
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+        return data;
+    }
+    // 非拥有视图，可交给接受 SqlistSpan 或 (指针, 长度) 的接口，不发生拷贝
+    SqlistSpan<T> span() { return SqlistSpan<T>(data_, size_); }
+    SqlistSpan<const T> span() const { return SqlistSpan<const T>(data_, size_); }
+
     // 交换容器
     void swap(DynamicSqlist& other) noexcept
     {
@@ -180,6 +249,8 @@ public:
     friend void swap(DynamicSqlist& a, DynamicSqlist& b) noexcept { a.swap(b); }
 
     // 迭代器
+    T* data() { return data_; }
+    const T* data() const { return data_; }
     T* begin() { return data_; }
     T* end() { return data_ + size_; }
     const T* begin() const { return data_; }
@@ -201,7 +272,7 @@ public:
     const T& operator[](int index) const { return data_[index]; }
 
     // 拷贝和移动相关
-    DynamicSqlist(const DynamicSqlist& other) : capacity_(other.capacity_), size_(other.size_), data_(new T[capacity_])
+    DynamicSqlist(const DynamicSqlist& other) : data_(new T[other.capacity_]), capacity_(other.capacity_), size_(other.size_)
     {
         std::copy(other.data_, other.data_ + size_, data_);
     }
@@ -239,20 +310,28 @@ public:
     }
 
 private:
+    template<typename InputIt>
+    void append(InputIt first, InputIt last, std::input_iterator_tag)
+    {
+        for (auto it = first; it != last; ++it) push_back(*it);
+    }
+    template<typename ForwardIt>
+    void append(ForwardIt first, ForwardIt last, std::forward_iterator_tag) { insert_range(size_, first, last); }
+
+    // 区间是否落在自己的数组内，只有指针区间可能如此
+    bool overlaps(const T* first, const T* last) const
+    {
+        std::less<const T*> less;
+        return first != last && !less(first, data_) && less(first, data_ + capacity_);
+    }
+    bool overlaps(T* first, T* last) const { return overlaps(static_cast<const T*>(first), static_cast<const T*>(last)); }
+    template<typename InputIt>
+    bool overlaps(InputIt, InputIt) const { return false; }
+
     // 动态扩容
     void resize()
     {
-        if (capacity_ == 0)
-        {
-            capacity_ = 1;
-            data_ = new T[capacity_];
-            return;
-        }
-        capacity_ *= 2;
-        T *newData = new T[capacity_];
-        std::copy(data_, data_ + size_, newData);
-        delete[] data_;
-        data_ = newData;
+        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
     }
 
     T* data_ = nullptr; // 接收 new 出来的数组地址
@@ -261,4 +340,4 @@ private:
 };
 
 
-#endif // DYNAMIC_SQLIST_H
\ No newline at end of file
+#endif // DYNAMIC_SQLIST_H
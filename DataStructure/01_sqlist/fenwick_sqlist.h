@@ -0,0 +1,159 @@
+#ifndef FENWICK_SQLIST_H
+#define FENWICK_SQLIST_H
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "dynamic_sqlist.h"
+
+// 带前缀聚合的数值顺序表
+// 在元素之外同时维护：
+//   树状数组（Fenwick）：区间和 O(log N)
+//   自底向上的线段树：区间最小值 O(log N)
+// 修改单个元素 O(log N)，尾插均摊 O(log N)（线段树叶子用完时翻倍重建），尾删 O(log N)。
+// 元素只能通过 set 修改，因此只提供只读访问。
+// 浮点类型的区间和由增量累加维护，大量修改后可能有舍入误差
+template <typename T>
+class FenwickSqlist
+{
+    static_assert(std::is_arithmetic<T>::value, "FenwickSqlist requires an arithmetic type");
+
+public:
+    // 构造函数
+    FenwickSqlist() = default;
+    FenwickSqlist(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+    template<typename InputIt>
+    FenwickSqlist(InputIt first, InputIt last) { assign(first, last); }
+
+    // 整体赋值 O(N)
+    template<typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        for (; first != last; ++first) data_.push_back(*first);
+        int n = data_.size();
+        tree_.reserve(n);
+        for (int i = 0; i < n; i++) tree_.push_back(data_[i]);
+        // 每个结点把自己加到父结点上，线性建树
+        for (int i = 1; i <= n; i++)
+        {
+            int parent = i + (i & -i);
+            if (parent <= n) tree_[parent - 1] += tree_[i - 1];
+        }
+        rebuild_min(n);
+    }
+
+    // 尾插 均摊 O(log N)
+    void push_back(T x)
+    {
+        data_.push_back(x);
+        // 新结点 i 覆盖 (i - lowbit(i), i]，等于 x 加上它下面各层结点
+        int i = data_.size();
+        T sum = x;
+        for (int step = 1; step < (i & -i); step <<= 1) sum += tree_[i - step - 1];
+        tree_.push_back(sum);
+        if (i > leaves_) rebuild_min(i);
+        else update_min(i - 1, x);
+    }
+    // 尾删 O(log N)
+    void pop_back()
+    {
+        if (data_.empty()) return;
+        data_.pop_back();
+        tree_.pop_back();
+        update_min(data_.size(), min_identity());
+    }
+    // 修改 O(log N)
+    void set(int index, T x)
+    {
+        if (index < 0 || index >= data_.size()) return;
+        T delta = x - data_[index];
+        data_[index] = x;
+        for (int i = index + 1; i <= data_.size(); i += i & -i) tree_[i - 1] += delta;
+        update_min(index, x);
+    }
+
+    // 查询
+    // 前 count 个元素之和 O(log N)
+    T prefix_sum(int count) const
+    {
+        if (count < 0 || count > data_.size()) throw std::out_of_range("Index out of bounds");
+        T sum = T();
+        for (int i = count; i > 0; i -= i & -i) sum += tree_[i - 1];
+        return sum;
+    }
+    // 闭区间 [l, r] 之和 O(log N)
+    T range_sum(int l, int r) const
+    {
+        if (l < 0 || l > r || r >= data_.size()) throw std::out_of_range("Index out of bounds");
+        return prefix_sum(r + 1) - prefix_sum(l);
+    }
+    // 闭区间 [l, r] 的最小值 O(log N)
+    T range_min(int l, int r) const
+    {
+        if (l < 0 || l > r || r >= data_.size()) throw std::out_of_range("Index out of bounds");
+        T result = min_identity();
+        for (int lo = l + leaves_, hi = r + leaves_ + 1; lo < hi; lo >>= 1, hi >>= 1)
+        {
+            if (lo & 1) result = std::min(result, min_tree_[lo++]);
+            if (hi & 1) result = std::min(result, min_tree_[--hi]);
+        }
+        return result;
+    }
+
+    // 按位查找 O(1)
+    const T& operator[](int index) const { return data_[index]; }
+    const T& at(int index) const { return data_.at(index); }
+    const T& front() const { return data_.front(); }
+    const T& back() const { return data_.back(); }
+
+    // 容量相关
+    int size() const noexcept { return data_.size(); }
+    bool empty() const noexcept { return data_.empty(); }
+    void clear()
+    {
+        data_.clear();
+        tree_.clear();
+        min_tree_.clear();
+        leaves_ = 0;
+    }
+
+    // 迭代器（只读）
+    const T* begin() const { return data_.begin(); }
+    const T* end() const { return data_.end(); }
+    SqlistSpan<const T> span() const { return data_.span(); }
+
+private:
+    static T min_identity()
+    {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    }
+
+    // 叶子个数取不小于 count 的 2 的幂，重建线段树 O(N)
+    void rebuild_min(int count)
+    {
+        int leaves = 1;
+        while (leaves < count) leaves <<= 1;
+        leaves_ = leaves;
+        min_tree_ = DynamicSqlist<T>(2 * leaves);
+        for (int i = 0; i < 2 * leaves; i++) min_tree_.push_back(min_identity());
+        for (int i = 0; i < data_.size(); i++) min_tree_[leaves + i] = data_[i];
+        for (int i = leaves - 1; i > 0; i--) min_tree_[i] = std::min(min_tree_[2 * i], min_tree_[2 * i + 1]);
+    }
+    // 修改叶子并向上更新 O(log N)
+    void update_min(int index, T x)
+    {
+        int i = index + leaves_;
+        min_tree_[i] = x;
+        for (i >>= 1; i > 0; i >>= 1) min_tree_[i] = std::min(min_tree_[2 * i], min_tree_[2 * i + 1]);
+    }
+
+    DynamicSqlist<T> data_;     // 元素
+    DynamicSqlist<T> tree_;     // 树状数组，tree_[i - 1] 为 (i - lowbit(i), i] 之和
+    DynamicSqlist<T> min_tree_; // 线段树，结点 i 的孩子为 2i 和 2i+1，叶子从 leaves_ 开始
+    int leaves_ = 0;            // 线段树叶子个数
+};
+
+
+#endif // FENWICK_SQLIST_H
@@ -0,0 +1,247 @@
+#ifndef INCREMENTAL_SQLIST_H
+#define INCREMENTAL_SQLIST_H
+#include <algorithm>
+#include <iterator>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "sqlist_span.h"
+
+// 渐进扩容的顺序表
+// DynamicSqlist 扩容时由触发扩容的那次 push_back 独自拷贝整个数组；这里扩容只分配新数组
+// （未构造的原始内存，不构造任何元素），之后每次 push_back / pop_back 顺带把至多 step 个旧元素
+// 移动构造到新数组并析构旧元素，旧数组搬空后随即释放。每次操作的搬移量有上界。
+// 释放旧数组时归还内存的开销与其大小有关，由搬空它的那次操作承担。
+//
+// 代价：元素可能还在旧数组中，下标访问多一次判断；连续区间访问（begin / end / data / span）
+// 要先把剩余元素一次搬完，因此只提供非 const 版本，const 对象请用下标访问。
+// 只提供尾部增删；需要中间插入删除、排序等请用 DynamicSqlist。
+template <typename T>
+class IncrementalSqlist
+{
+public:
+    // 构造函数，step 为每次操作搬移的元素个数，至少为 1
+    explicit IncrementalSqlist(int step = 2) : step_(step > 0 ? step : 1) {}
+    IncrementalSqlist(std::initializer_list<T> init) : step_(2)
+    {
+        for (const auto & item : init)
+        {
+            push_back(item);
+        }
+    }
+    ~IncrementalSqlist() { clear(); }
+
+    // 增
+    // 尾插 O(1)，每次至多搬移 step 个旧元素
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    void push_back(U&& x)
+    {
+        if (size_ >= capacity_) resize();
+        if (old_data_ && size_ >= migrated_ && size_ < old_size_) old_data_[size_] = std::forward<U>(x);
+        else if (size_ < built_) data_[size_] = std::forward<U>(x);
+        else
+        {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<U>(x));
+            built_ = size_ + 1;
+        }
+        size_++;
+        if (old_data_) migrate(step_);
+    }
+
+    // 删
+    // 尾删 O(1)，每次至多搬移 step 个旧元素
+    void pop_back()
+    {
+        if (size_ <= 0) return;
+        size_--;
+        if (old_data_) migrate(step_);
+    }
+
+    // 改 O(1)
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    void set(int index, U&& x)
+    {
+        if (index < 0 || index >= size_) return;
+        slot(index) = std::forward<U>(x);
+    }
+
+    // 查
+    // 按位查找 O(1)
+    T& at(int index)
+    {
+        if (index < 0 || index >= size_) throw std::out_of_range("Index out of bounds");
+        return slot(index);
+    }
+    const T& at(int index) const
+    {
+        if (index < 0 || index >= size_) throw std::out_of_range("Index out of bounds");
+        return slot(index);
+    }
+    // 首尾元素 O(1)
+    T& front() { return size_ ? slot(0) : throw std::out_of_range("List is empty"); }
+    const T& front() const { return size_ ? slot(0) : throw std::out_of_range("List is empty"); }
+    T& back() { return size_ ? slot(size_ - 1) : throw std::out_of_range("List is empty"); }
+    const T& back() const { return size_ ? slot(size_ - 1) : throw std::out_of_range("List is empty"); }
+
+    // 清空操作
+    void clear()
+    {
+        if (old_data_)
+        {
+            destroy(data_, data_ + migrated_);
+            destroy(data_ + old_size_, data_ + built_);
+            destroy(old_data_ + migrated_, old_data_ + old_size_);
+            ::operator delete(old_data_);
+        }
+        else
+        {
+            destroy(data_, data_ + built_);
+        }
+        ::operator delete(data_);
+        data_ = old_data_ = nullptr;
+        capacity_ = size_ = built_ = old_size_ = migrated_ = 0;
+    }
+
+    // 容量相关
+    // 预留容量 O(N)，一次性完成，容量足够时不做任何事
+    void reserve(int new_capacity)
+    {
+        if (new_capacity <= capacity_) return;
+        finish_migration();
+        T* new_data = allocate(new_capacity);
+        std::uninitialized_copy(std::make_move_iterator(data_), std::make_move_iterator(data_ + size_), new_data);
+        destroy(data_, data_ + built_);
+        ::operator delete(data_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+        built_ = size_;
+    }
+    int capacity() const noexcept { return capacity_; }
+    int size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    // 每次操作搬移的元素个数
+    int step() const noexcept { return step_; }
+    void set_step(int step) { step_ = step > 0 ? step : 1; }
+    // 是否有尚未搬完的旧数组
+    bool migrating() const noexcept { return old_data_ != nullptr; }
+
+    // 交换容器
+    void swap(IncrementalSqlist& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(built_, other.built_);
+        std::swap(old_data_, other.old_data_);
+        std::swap(old_size_, other.old_size_);
+        std::swap(migrated_, other.migrated_);
+        std::swap(step_, other.step_);
+    }
+    friend void swap(IncrementalSqlist& a, IncrementalSqlist& b) noexcept { a.swap(b); }
+
+    // 迭代器：先搬完剩余元素 O(N)，保证返回的指针区间连续
+    T* data() { finish_migration(); return data_; }
+    T* begin() { return data(); }
+    T* end() { return data() + size_; }
+    SqlistSpan<T> span() { return SqlistSpan<T>(data(), size_); }
+
+    // 运算符重载
+    T& operator[](int index) { return slot(index); }
+    const T& operator[](int index) const { return slot(index); }
+
+    // 拷贝和移动相关，均沿用源对象的 step；拷贝按下标读取，不修改源对象
+    IncrementalSqlist(const IncrementalSqlist& other)
+        : data_(allocate(other.capacity_)), capacity_(other.capacity_), size_(other.size_), built_(other.size_),
+          step_(other.step_)
+    {
+        for (int i = 0; i < size_; i++) ::new (static_cast<void*>(data_ + i)) T(other.slot(i));
+    }
+    IncrementalSqlist& operator=(const IncrementalSqlist& other)
+    {
+        if (this != &other)
+        {
+            IncrementalSqlist temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+    IncrementalSqlist(IncrementalSqlist&& other) noexcept : step_(other.step_) { swap(other); }
+    IncrementalSqlist& operator=(IncrementalSqlist&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+private:
+    // 分配未构造的原始内存
+    static T* allocate(int capacity) { return capacity > 0 ? static_cast<T*>(::operator new(sizeof(T) * capacity)) : nullptr; }
+    // 析构 [first, last) 中的元素
+    static void destroy(T*, T*, std::true_type /* trivially destructible */) {}
+    static void destroy(T* first, T* last, std::false_type)
+    {
+        for (; first != last; ++first) first->~T();
+    }
+    static void destroy(T* first, T* last) { destroy(first, last, std::is_trivially_destructible<T>()); }
+
+    // 动态扩容：旧数组保留到元素搬完为止，新数组只分配不构造
+    void resize()
+    {
+        if (size_ == 0)
+        {
+            reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+            return;
+        }
+        finish_migration();
+        destroy(data_ + size_, data_ + built_);
+        old_data_ = data_;
+        old_size_ = size_;
+        migrated_ = 0;
+        built_ = size_;
+        capacity_ *= 2;
+        data_ = allocate(capacity_);
+    }
+
+    // 从旧数组移动构造至多 count 个元素到新数组并析构旧元素，搬完后释放旧数组
+    // 搬移期间新数组中已构造的位置为 [0, migrated_) 和 [old_size_, built_)
+    void migrate(int count)
+    {
+        int stop = std::min(migrated_ + count, old_size_);
+        for (int i = migrated_; i < stop; i++)
+        {
+            ::new (static_cast<void*>(data_ + i)) T(std::move(old_data_[i]));
+            old_data_[i].~T();
+        }
+        migrated_ = stop;
+        if (migrated_ < old_size_) return;
+        ::operator delete(old_data_);
+        old_data_ = nullptr;
+        old_size_ = migrated_ = 0;
+    }
+    void finish_migration()
+    {
+        if (old_data_) migrate(old_size_);
+    }
+
+    // 按下标定位元素：下标在 [migrated_, old_size_) 的元素仍在旧数组中
+    T& slot(int index) { return (old_data_ && index >= migrated_ && index < old_size_) ? old_data_[index] : data_[index]; }
+    const T& slot(int index) const { return (old_data_ && index >= migrated_ && index < old_size_) ? old_data_[index] : data_[index]; }
+
+    T* data_ = nullptr; // 当前数组（原始内存）
+    int capacity_ = 0; // 标记当前数组的实际大小
+    int size_ = 0; // 标记有效元素个数
+    int built_ = 0; // data_ 中已构造的位置上界，元素个数之外的位置构造后保留
+    T* old_data_ = nullptr; // 尚未搬完的旧数组
+    int old_size_ = 0; // 旧数组中待搬移元素的上界
+    int migrated_ = 0; // 旧数组中已搬到新数组的元素个数
+    int step_ = 2; // 每次操作搬移的元素个数
+};
+
+
+#endif // INCREMENTAL_SQLIST_H
@@ -1,8 +1,20 @@
 #include <iostream>
 #include "static_sqlist.h"
 #include "dynamic_sqlist.h"
+#include "incremental_sqlist.h"
+#include "sqlist_edit_batch.h"
+#include "sqlist_heap.h"
+#include "slot_map.h"
+#include "fenwick_sqlist.h"
+#include "sqlist_io.h"
 #include <array>
 #include <vector>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
 
 const int N = 1e6 + 10;
 StaticSqlist<int, N> array;
@@ -194,9 +206,405 @@ void test_dynamic_array()
 
 }
 
+// 只接受视图的“第三方”接口：std::vector、顺序表、原始数组都能直接传入
+long long sum_span(SqlistSpan<const int> values)
+{
+    long long sum = 0;
+    for (int x : values) sum += x;
+    return sum;
+}
+
+void test_interop()
+{
+    std::vector<int> vec = {1, 2, 3, 4, 5};
+    dynamicArray.clear();
+    dynamicArray.append({10, 20, 30});
+    int raw[] = {7, 8, 9};
+    std::cout << "vector 求和: " << sum_span(vec) << std::endl;
+    std::cout << "顺序表求和: " << sum_span(dynamicArray) << std::endl;
+    std::cout << "数组求和: " << sum_span(raw) << std::endl;
+    std::cout << "子视图求和: " << sum_span(SqlistSpan<int>(vec).subspan(1, 3)) << std::endl;
+
+    // 视图可写，修改直接作用于 vector
+    SqlistSpan<int> view(vec);
+    view[0] = 100;
+    std::cout << "vec[0]: " << vec[0] << std::endl;
+
+    // 从 vector 整段追加（一次拷贝）
+    dynamicArray.append(vec);
+    printDynamicArray();
+
+    // 在两个顺序表之间转交缓冲区：release 交出 new[] 数组，adopt 接管，全程不拷贝元素
+    int size = dynamicArray.size(), capacity = dynamicArray.capacity();
+    int* buffer = dynamicArray.release();
+    DynamicSqlist<int> next;
+    next.adopt(buffer, size, capacity);
+    std::cout << "转交后: 原表大小 " << dynamicArray.size() << ", 新表大小 " << next.size()
+              << ", 同一块内存: " << (next.data() == buffer ? "是" : "否") << std::endl;
+}
+
+void test_slot_map()
+{
+    SlotMap<std::string> names;
+    SlotMapHandle a = names.insert("a");
+    SlotMapHandle b = names.insert("b");
+    SlotMapHandle c = names.insert("c");
+    names.erase(a); // 用尾元素 "c" 填补空位
+    for (const auto& name : names) std::cout << name << " ";
+    std::cout << std::endl;
+    std::cout << "b: " << names.at(b) << ", c: " << names.at(c) << std::endl;
+    std::cout << "a 是否有效: " << (names.contains(a) ? "是" : "否") << std::endl;
+
+    // 新元素复用 a 的槽位，但版本号不同，旧句柄依然无效
+    SlotMapHandle d = names.insert("d");
+    std::cout << "复用槽位: " << (d.index == a.index ? "是" : "否") << ", a 是否有效: " << (names.get(a) ? "是" : "否") << std::endl;
+}
+
+void test_edit_batch()
+{
+    // 下标均指向应用前的原始顺序表
+    dynamicArray.clear();
+    dynamicArray.append({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    printDynamicArray();
+
+    std::cout << "批量编辑" << std::endl;
+    SqlistEditBatch<int> batch;
+    batch.insert(0, 100);   // 头部插入
+    batch.erase(2);         // 删除原来的 2
+    batch.set(5, 50);       // 修改原来的 5
+    batch.insert(5, 40);    // 在原来的 5 之前插入
+    batch.insert(5, 45);    // 同一位置按添加顺序排列
+    batch.erase(9);         // 删除原来的 9
+    batch.insert(10, 200);  // 尾部插入
+    std::cout << "应用: " << (batch.apply(dynamicArray) ? "成功" : "失败") << std::endl;
+    printDynamicArray(); // 100 0 1 3 4 40 45 50 6 7 8 200
+
+    batch.erase(100);
+    std::cout << "越界下标: " << (batch.apply(dynamicArray) ? "成功" : "失败") << std::endl;
+}
+
+// 计时，返回毫秒
+template<typename F>
+double elapsed_ms(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 对比 std::sort / std::stable_sort 与顺序表的 sort / stable_sort / parallel_sort
+template<typename T>
+void bench_sort_case(const std::string& name, const DynamicSqlist<T>& input)
+{
+    DynamicSqlist<T> a(input), b(input), c(input), d(input), e(input);
+    double t1 = elapsed_ms([&] { std::sort(a.begin(), a.end()); });
+    double t2 = elapsed_ms([&] { std::stable_sort(b.begin(), b.end()); });
+    double t3 = elapsed_ms([&] { c.sort(); });
+    double t4 = elapsed_ms([&] { d.stable_sort(); });
+    double t5 = elapsed_ms([&] { e.parallel_sort(); });
+    bool ok = std::equal(a.begin(), a.end(), c.begin()) && std::equal(a.begin(), a.end(), d.begin())
+        && std::equal(a.begin(), a.end(), e.begin());
+    std::cout << name << ": std::sort " << t1 << "ms, std::stable_sort " << t2 << "ms, sort " << t3
+              << "ms, stable_sort " << t4 << "ms, parallel_sort " << t5 << "ms" << (ok ? "" : " [结果不一致]") << std::endl;
+}
+
+void bench_sort()
+{
+    const int n = 1000000;
+    std::mt19937 rng(42);
+    DynamicSqlist<int> random_int(n), sorted_int(n), few_int(n);
+    DynamicSqlist<double> random_double(n), few_double(n);
+    DynamicSqlist<std::string> random_string(n / 10);
+    for (int i = 0; i < n; i++)
+    {
+        random_int.push_back(static_cast<int>(rng()));
+        sorted_int.push_back(i);
+        few_int.push_back(static_cast<int>(rng() % 16));
+        random_double.push_back(std::uniform_real_distribution<double>(-1e9, 1e9)(rng));
+        few_double.push_back(static_cast<double>(rng() % 16) / 4);
+    }
+    for (int i = 0; i < n / 10; i++) random_string.push_back(std::to_string(rng()));
+
+    std::cout << "排序 " << n << " 个元素" << std::endl;
+    bench_sort_case("int 随机    ", random_int);
+    bench_sort_case("int 有序    ", sorted_int);
+    bench_sort_case("int 少量取值", few_int);
+    bench_sort_case("double 随机 ", random_double);
+    bench_sort_case("double 少量 ", few_double);
+    bench_sort_case("string 随机 ", random_string);
+}
+
+// 逐次计时 push_back，按 2 的幂纳秒分桶输出延迟直方图和分位数
+template<typename List>
+void bench_growth_case(const std::string& name, int n)
+{
+    typedef typename std::decay<decltype(std::declval<List&>()[0])>::type T;
+    List list;
+    std::vector<long long> latency(n);
+    auto total_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+    {
+        T x = T();
+        auto start = std::chrono::steady_clock::now();
+        list.push_back(std::move(x));
+        latency[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - total_start).count();
+
+    // 触发扩容（下标 2^k）以及渐进扩容 step=2 时搬完旧数组（下标 2^k + 2^(k-1) 附近）的那几次 push_back，
+    // 其余位置的毛刺主要来自缺页和系统调度，预先 reserve 的 std::vector 上同样存在
+    long long growth_max = 0;
+    for (long long k = 1; k < n; k *= 2)
+    {
+        long long points[] = {k, k + k / 2 - 1, k + k / 2, k + k / 2 + 1};
+        for (long long j : points)
+        {
+            if (j < n) growth_max = std::max(growth_max, latency[j]);
+        }
+    }
+
+    int histogram[64] = {0};
+    for (long long ns : latency)
+    {
+        int bucket = 0;
+        while ((2LL << bucket) <= ns) bucket++;
+        histogram[bucket]++;
+    }
+    std::sort(latency.begin(), latency.end());
+    std::cout << name << ": 总耗时 " << total << "ms, p50 " << latency[n / 2] << "ns, p99 " << latency[n / 100 * 99]
+              << "ns, p99.9 " << latency[n / 1000 * 999] << "ns, max " << latency[n - 1] << "ns, 扩容/搬完时 max "
+              << growth_max << "ns" << std::endl;
+    for (int b = 0; b < 64; b++)
+    {
+        if (histogram[b]) std::cout << "    [" << (1LL << b) << "ns, " << (2LL << b) << "ns): " << histogram[b] << std::endl;
+    }
+}
+
+void bench_growth()
+{
+    const int n = 1 << 24;
+    std::cout << "push_back " << n << " 个 int 的单次延迟" << std::endl;
+    bench_growth_case<DynamicSqlist<int>>("DynamicSqlist            ", n);
+    bench_growth_case<IncrementalSqlist<int>>("IncrementalSqlist(step=2)", n);
+    // 不可平凡构造的类型：一次性扩容还要构造 / 析构整个数组
+    const int m = 1 << 22;
+    std::cout << "push_back " << m << " 个 std::string 的单次延迟" << std::endl;
+    bench_growth_case<DynamicSqlist<std::string>>("DynamicSqlist            ", m);
+    bench_growth_case<IncrementalSqlist<std::string>>("IncrementalSqlist(step=2)", m);
+}
+
+// 逐个入堆再全部出堆，以及批量建堆再全部出堆，重复 rounds 轮，输出每个元素的平均耗时
+template<typename Heap>
+void bench_heap_case(const std::string& name, const DynamicSqlist<int>& input, int rounds)
+{
+    Heap heap;
+    long long check = 0;
+    double t1 = elapsed_ms([&] {
+        for (int r = 0; r < rounds; r++)
+        {
+            for (int x : input) heap.push(x);
+            while (!heap.empty()) { check += heap.top(); heap.pop(); }
+        }
+    });
+    double t2 = elapsed_ms([&] {
+        for (int r = 0; r < rounds; r++)
+        {
+            heap.heapify(input.begin(), input.end());
+            while (!heap.empty()) { check -= heap.top(); heap.pop(); }
+        }
+    });
+    double ops = 1e-6 * input.size() * rounds;
+    std::cout << name << ": push+pop " << t1 / ops << "ns, heapify+pop " << t2 / ops << "ns"
+              << (check == 0 ? "" : " [结果不一致]") << std::endl;
+}
+
+// 基准：在顺序表的原始指针上使用 std::push_heap / std::pop_heap，不维护句柄
+void bench_std_heap_case(const DynamicSqlist<int>& input, int rounds)
+{
+    DynamicSqlist<int> raw(input.size());
+    double t1 = elapsed_ms([&] {
+        for (int r = 0; r < rounds; r++)
+        {
+            for (int x : input)
+            {
+                raw.push_back(x);
+                std::push_heap(raw.begin(), raw.end(), std::greater<int>());
+            }
+            while (!raw.empty())
+            {
+                std::pop_heap(raw.begin(), raw.end(), std::greater<int>());
+                raw.pop_back();
+            }
+        }
+    });
+    double t2 = elapsed_ms([&] {
+        for (int r = 0; r < rounds; r++)
+        {
+            raw.append(input.span());
+            std::make_heap(raw.begin(), raw.end(), std::greater<int>());
+            while (!raw.empty())
+            {
+                std::pop_heap(raw.begin(), raw.end(), std::greater<int>());
+                raw.pop_back();
+            }
+        }
+    });
+    double ops = 1e-6 * input.size() * rounds;
+    std::cout << "std::*_heap  : push+pop " << t1 / ops << "ns, heapify+pop " << t2 / ops << "ns" << std::endl;
+}
+
+// 同样的总元素数，分别在能放进 L1/L2 的小堆和远超末级缓存的大堆上测试：
+// 小堆中多叉只是少几层、多几次比较，大堆中每下沉一层都是一次缓存未命中，
+// 兄弟结点落在同一条缓存行、树高更低的 4 / 8 叉堆优势才显现出来
+void bench_heap()
+{
+    const int total = 1 << 22;
+    const int sizes[] = {1 << 12, 1 << 22};
+    std::mt19937 rng(42);
+    for (int n : sizes)
+    {
+        DynamicSqlist<int> input(n);
+        for (int i = 0; i < n; i++) input.push_back(static_cast<int>(rng()));
+        int rounds = total / n;
+        std::cout << "小根堆 " << n << " 个 int（" << n * sizeof(int) / 1024 << "KB）x " << rounds << " 轮，每个元素" << std::endl;
+        bench_std_heap_case(input, rounds);
+        bench_heap_case<BinaryHeap<int>>("BinaryHeap   ", input, rounds);
+        bench_heap_case<FourAryHeap<int>>("FourAryHeap  ", input, rounds);
+        bench_heap_case<EightAryHeap<int>>("EightAryHeap ", input, rounds);
+    }
+}
+
+// 可平凡复制的 POD 结构体，插入 / 删除时整体 memmove
+struct PodPoint
+{
+    int x, y, z, w;
+};
+// 布局相同但带自定义赋值运算符，不可平凡复制，走逐个 std::move 的通用路径
+template<typename T>
+struct NonTrivial
+{
+    T value;
+    NonTrivial() = default;
+    NonTrivial(const T& v) : value(v) {}
+    NonTrivial& operator=(const NonTrivial& other) { value = other.value; return *this; }
+};
+
+// 在 n 个元素的顺序表上各执行 ops 次头插 / 中间插入 / 头删 / 中间删除
+template<typename T>
+void bench_shift_case(const std::string& name, int n, int ops)
+{
+    DynamicSqlist<T> list(n + ops);
+    for (int i = 0; i < n; i++) list.push_back(T());
+    double t1 = elapsed_ms([&] { for (int i = 0; i < ops; i++) list.push_front(T()); });
+    double t2 = elapsed_ms([&] { for (int i = 0; i < ops; i++) list.pop_front(); });
+    double t3 = elapsed_ms([&] { for (int i = 0; i < ops; i++) list.insert(list.size() / 2, T()); });
+    double t4 = elapsed_ms([&] { for (int i = 0; i < ops; i++) list.erase(list.size() / 2); });
+    T one[1] = {T()};
+    double t5 = elapsed_ms([&] {
+        for (int i = 0; i < ops; i++)
+        {
+            list.erase_range(0, 1);
+            list.insert_range(0, one, 1);
+        }
+    });
+    std::cout << name << ": push_front " << t1 << "ms, pop_front " << t2 << "ms, insert " << t3
+              << "ms, erase " << t4 << "ms, erase_range+insert_range " << t5 << "ms" << std::endl;
+}
+
+void bench_shift()
+{
+    const int n = 1000000, ops = 2000;
+    std::cout << n << " 个元素上各执行 " << ops << " 次 O(N) 操作" << std::endl;
+    bench_shift_case<int>("int (memmove)          ", n, ops);
+    bench_shift_case<NonTrivial<int>>("int (逐个移动)         ", n, ops);
+    bench_shift_case<PodPoint>("PodPoint (memmove)     ", n, ops);
+    bench_shift_case<NonTrivial<PodPoint>>("PodPoint (逐个移动)    ", n, ops);
+}
+
+// 区间和 / 区间最小值：FenwickSqlist 对比每次重新扫描 DynamicSqlist
+void bench_fenwick()
+{
+    const int n = 1000000, ops = 10000;
+    std::mt19937 rng(42);
+    DynamicSqlist<long long> plain;
+    FenwickSqlist<long long> fenwick;
+    double t1 = elapsed_ms([&] { for (int i = 0; i < n; i++) plain.push_back(static_cast<long long>(rng() % 1000)); });
+    double t2 = elapsed_ms([&] { for (int i = 0; i < n; i++) fenwick.push_back(plain[i]); });
+
+    // 修改与查询交替进行
+    long long check = 0;
+    std::mt19937 rng1(7), rng2(7);
+    double t3 = elapsed_ms([&] {
+        for (int i = 0; i < ops; i++)
+        {
+            plain.set(rng1() % n, static_cast<long long>(rng1() % 1000));
+            int l = rng1() % n, r = l + rng1() % (n - l);
+            long long sum = 0, min = plain[l];
+            for (int k = l; k <= r; k++)
+            {
+                sum += plain[k];
+                min = std::min(min, plain[k]);
+            }
+            check += sum + min;
+        }
+    });
+    double t4 = elapsed_ms([&] {
+        for (int i = 0; i < ops; i++)
+        {
+            fenwick.set(rng2() % n, static_cast<long long>(rng2() % 1000));
+            int l = rng2() % n, r = l + rng2() % (n - l);
+            check -= fenwick.range_sum(l, r) + fenwick.range_min(l, r);
+        }
+    });
+    std::cout << n << " 个元素，" << ops << " 次修改 + 区间和 + 区间最小值" << std::endl;
+    std::cout << "尾插建表: DynamicSqlist " << t1 << "ms, FenwickSqlist " << t2 << "ms" << std::endl;
+    std::cout << "查询: 重新扫描 " << t3 << "ms, FenwickSqlist " << t4 << "ms" << (check == 0 ? "" : " [结果不一致]") << std::endl;
+}
+
+// 文本读写：逐个 operator<< / operator>> 对比 sqlist_io 的整块读写
+void bench_io()
+{
+    const int n = 10000000;
+    const char* path = "bench_numbers.txt";
+    std::mt19937 rng(42);
+    DynamicSqlist<int> list(n);
+    for (int i = 0; i < n; i++) list.push_back(static_cast<int>(rng()));
+
+    double t1 = elapsed_ms([&] {
+        std::ofstream out(path);
+        for (int x : list) out << x << ' ';
+        out << '\n';
+    });
+    DynamicSqlist<int> a;
+    double t2 = elapsed_ms([&] {
+        std::ifstream in(path);
+        int x;
+        while (in >> x) a.push_back(x);
+    });
+    double t3 = elapsed_ms([&] { sqlist_io::write_numbers(path, list); });
+    DynamicSqlist<int> b;
+    double t4 = elapsed_ms([&] { sqlist_io::read_numbers(path, b); });
+    std::remove(path);
+
+    bool ok = a.size() == n && b.size() == n && std::equal(list.begin(), list.end(), a.begin())
+        && std::equal(list.begin(), list.end(), b.begin());
+    std::cout << "文本读写 " << n << " 个 int" << std::endl;
+    std::cout << "operator<< " << t1 << "ms, operator>> " << t2 << "ms" << std::endl;
+    std::cout << "write_numbers " << t3 << "ms, read_numbers " << t4 << "ms" << (ok ? "" : " [结果不一致]") << std::endl;
+}
+
 int main()
 {
     // test_static_array();
     test_dynamic_array();
+    // test_edit_batch();
+    // test_interop();
+    // test_slot_map();
+    // bench_sort();
+    // bench_growth();
+    // bench_heap();
+    // bench_shift();
+    // bench_fenwick();
+    // bench_io();
 	return 0;
 }
@@ -0,0 +1,164 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+#include <stdexcept>
+#include "dynamic_sqlist.h"
+
+// 槽位映射（slot map）
+// 元素紧密存放在一个动态顺序表中，遍历时是连续内存；外部通过句柄访问元素。
+// 句柄 = 槽位下标 + 版本号，槽位记录元素在紧密数组中的位置：
+//   插入 O(1)：复用空闲槽位（空闲槽位串成链表），元素追加到紧密数组尾部
+//   删除 O(1)：用尾元素覆盖被删元素再尾删，只需修正尾元素所在槽位
+// 删除时槽位版本号加一，旧句柄随之失效，不会误访问到复用该槽位的新元素。
+// 版本号为奇数表示槽位被占用，偶数表示空闲
+struct SlotMapHandle
+{
+    int index = -1;         // 槽位下标
+    unsigned generation = 0; // 版本号
+
+    bool operator==(const SlotMapHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotMapHandle& other) const { return !(*this == other); }
+};
+
+template <typename T>
+class SlotMap
+{
+public:
+    using Handle = SlotMapHandle;
+
+    // 构造函数
+    SlotMap() = default;
+
+    // 插入 O(1)，返回句柄
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    Handle insert(U&& x)
+    {
+        int index;
+        if (free_head_ >= 0)
+        {
+            index = free_head_;
+            free_head_ = slots_[index].position;
+        }
+        else
+        {
+            index = slots_.size();
+            slots_.push_back(Slot());
+        }
+        Slot& slot = slots_[index];
+        slot.generation++;
+        slot.position = values_.size();
+        values_.push_back(std::forward<U>(x));
+        owners_.push_back(index);
+
+        Handle handle;
+        handle.index = index;
+        handle.generation = slot.generation;
+        return handle;
+    }
+
+    // 删除 O(1)，句柄已失效时返回 false
+    bool erase(Handle handle)
+    {
+        if (!contains(handle)) return false;
+        Slot& slot = slots_[handle.index];
+        int position = slot.position;
+        int last = values_.size() - 1;
+        if (position != last)
+        {
+            values_[position] = std::move(values_[last]);
+            owners_[position] = owners_[last];
+            slots_[owners_[position]].position = position;
+        }
+        // 顺序表尾删不析构元素，这里换成默认值，及时释放被删元素持有的资源（如 shared_ptr）
+        values_[last] = T();
+        values_.pop_back();
+        owners_.pop_back();
+
+        slot.generation++;
+        slot.position = free_head_;
+        free_head_ = handle.index;
+        return true;
+    }
+    bool remove(Handle handle) { return erase(handle); }
+
+    // 按句柄访问 O(1)
+    bool contains(Handle handle) const noexcept
+    {
+        return handle.index >= 0 && handle.index < slots_.size() && slots_[handle.index].generation == handle.generation
+            && (handle.generation & 1u);
+    }
+    // 句柄失效时返回 nullptr
+    T* get(Handle handle) { return contains(handle) ? &values_[slots_[handle.index].position] : nullptr; }
+    const T* get(Handle handle) const { return contains(handle) ? &values_[slots_[handle.index].position] : nullptr; }
+    T& at(Handle handle)
+    {
+        if (!contains(handle)) throw std::out_of_range("Invalid slot map handle");
+        return values_[slots_[handle.index].position];
+    }
+    const T& at(Handle handle) const
+    {
+        if (!contains(handle)) throw std::out_of_range("Invalid slot map handle");
+        return values_[slots_[handle.index].position];
+    }
+    // 不检查句柄
+    T& operator[](Handle handle) { return values_[slots_[handle.index].position]; }
+    const T& operator[](Handle handle) const { return values_[slots_[handle.index].position]; }
+
+    // 紧密数组中第 position 个元素的句柄，遍历时配合使用
+    Handle handle_at(int position) const
+    {
+        if (position < 0 || position >= values_.size()) throw std::out_of_range("Index out of bounds");
+        Handle handle;
+        handle.index = owners_[position];
+        handle.generation = slots_[handle.index].generation;
+        return handle;
+    }
+
+    // 容量相关
+    int size() const noexcept { return values_.size(); }
+    bool empty() const noexcept { return values_.empty(); }
+    void reserve(int capacity)
+    {
+        values_.reserve(capacity);
+        owners_.reserve(capacity);
+        slots_.reserve(capacity);
+    }
+
+    // 清空 O(N)，槽位保留，所有旧句柄失效
+    void clear()
+    {
+        for (int i = 0; i < owners_.size(); i++)
+        {
+            Slot& slot = slots_[owners_[i]];
+            slot.generation++;
+            slot.position = free_head_;
+            free_head_ = owners_[i];
+        }
+        values_.clear();
+        owners_.clear();
+    }
+
+    // 迭代器：按紧密数组顺序遍历，删除元素会改变顺序
+    T* begin() { return values_.begin(); }
+    T* end() { return values_.end(); }
+    const T* begin() const { return values_.begin(); }
+    const T* end() const { return values_.end(); }
+    T* data() { return values_.data(); }
+    const T* data() const { return values_.data(); }
+    SqlistSpan<T> span() { return values_.span(); }
+    SqlistSpan<const T> span() const { return values_.span(); }
+
+private:
+    struct Slot
+    {
+        int position = -1;       // 占用时为元素在紧密数组中的下标，空闲时为下一个空闲槽位
+        unsigned generation = 0; // 版本号
+    };
+
+    DynamicSqlist<T> values_;  // 紧密存放的元素
+    DynamicSqlist<int> owners_; // 紧密数组下标 -> 槽位下标
+    DynamicSqlist<Slot> slots_; // 槽位
+    int free_head_ = -1;        // 空闲槽位链表头
+};
+
+
+#endif // SLOT_MAP_H
@@ -0,0 +1,160 @@
+#ifndef SQLIST_EDIT_BATCH_H
+#define SQLIST_EDIT_BATCH_H
+#include <algorithm>
+#include "sqlist_move.h"
+#include "static_sqlist.h"
+#include "dynamic_sqlist.h"
+
+// 批量位置编辑
+// 收集若干 insert / erase / set 操作，下标一律指向应用前的原始顺序表，
+// 然后一次性合并到顺序表中：排序 O(k log k) + 一趟压缩 + 一趟展开 O(N)，
+// 动态顺序表至多扩容一次。逐个调用 insert / erase 则每次都要搬移尾部，总计 O(k*N)。
+//
+// 语义：
+//   insert(i, x) 在原第 i 个元素之前插入 x（i == size 表示尾部），同一位置按添加顺序排列
+//   erase(i)     删除原第 i 个元素
+//   set(i, x)    修改原第 i 个元素，多次修改以最后一次为准，与 erase 同时出现时以删除为准
+template <typename T>
+class SqlistEditBatch
+{
+public:
+    SqlistEditBatch() = default;
+
+    // 记录操作 O(1)
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    void insert(int index, U&& x) { add(index, INSERT, std::forward<U>(x)); }
+    void erase(int index) { add(index, ERASE, T()); }
+    void remove(int index) { erase(index); }
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    void set(int index, U&& x) { add(index, SET, std::forward<U>(x)); }
+
+    int size() const noexcept { return ops_.size(); }
+    bool empty() const noexcept { return ops_.empty(); }
+    void clear() { ops_ = DynamicSqlist<Op>(); }
+
+    // 应用到顺序表 O(N + k log k)
+    // 下标越界、重复删除或静态表容量不足时返回 false，顺序表保持不变
+    // 成功后批次被清空（元素值已移动到顺序表中）
+    bool apply(DynamicSqlist<T>& list)
+    {
+        int final_size;
+        if (!prepare(list.size(), final_size)) return false;
+        list.reserve(final_size);
+        merge(list, final_size);
+        return true;
+    }
+    template<int MAX_SIZE>
+    bool apply(StaticSqlist<T, MAX_SIZE>& list)
+    {
+        int final_size;
+        if (!prepare(list.size(), final_size) || final_size > MAX_SIZE) return false;
+        merge(list, final_size);
+        return true;
+    }
+
+private:
+    enum Kind { INSERT = 0, SET = 1, ERASE = 2 };
+    struct Op
+    {
+        int index;
+        int kind;
+        T value;
+    };
+
+    template<typename U>
+    void add(int index, Kind kind, U&& x)
+    {
+        Op op;
+        op.index = index;
+        op.kind = kind;
+        op.value = std::forward<U>(x);
+        ops_.push_back(std::move(op));
+    }
+
+    // 按原始下标排序并校验，计算应用后的长度
+    // 同一下标上插入排在前面，set / erase 保持添加顺序（稳定排序）
+    bool prepare(int n, int& final_size)
+    {
+        std::stable_sort(ops_.begin(), ops_.end(), [](const Op& a, const Op& b) {
+            if (a.index != b.index) return a.index < b.index;
+            return (a.kind == INSERT) > (b.kind == INSERT);
+        });
+        final_size = n;
+        int last_erase = -1;
+        for (const auto& op : ops_)
+        {
+            if (op.kind == INSERT)
+            {
+                if (op.index < 0 || op.index > n) return false;
+                final_size++;
+            }
+            else
+            {
+                if (op.index < 0 || op.index >= n) return false;
+                if (op.kind == ERASE)
+                {
+                    if (op.index == last_erase) return false;
+                    last_erase = op.index;
+                    final_size--;
+                }
+            }
+        }
+        return true;
+    }
+
+    // 调用前需保证 list 的容量不小于 final_size
+    template<typename List>
+    void merge(List& list, int final_size)
+    {
+        int n = list.size();
+        int k = ops_.size();
+        int inserts = 0;
+
+        // 第一趟（从前往后）：执行 set / erase 并把保留的元素向前压缩，
+        // 同时把插入操作的下标换算成压缩后的位置
+        T* data = list.begin();
+        int w = 0, p = 0;
+        for (int i = 0; i <= n; i++)
+        {
+            while (p < k && ops_[p].index == i && ops_[p].kind == INSERT)
+            {
+                ops_[p++].index = w;
+                inserts++;
+            }
+            if (i == n) break;
+            bool erased = false;
+            while (p < k && ops_[p].index == i)
+            {
+                if (ops_[p].kind == ERASE) erased = true;
+                else if (!erased) data[i] = std::move(ops_[p].value);
+                p++;
+            }
+            if (erased) continue;
+            if (w != i) data[w] = std::move(data[i]);
+            w++;
+        }
+
+        // 调整长度：截掉压缩后的尾部，再为插入的元素占位（容量已足够，不会扩容）
+        if (w < n) list.erase_range(w, n - w);
+        for (int j = 0; j < inserts; j++) list.push_back(T());
+
+        // 第二趟（从后往前）：把各段整体后移，在空出来的位置放入插入的元素
+        data = list.begin();
+        int r = w, pos = final_size;
+        for (int j = k - 1; j >= 0; j--)
+        {
+            if (ops_[j].kind != INSERT) continue;
+            int at = ops_[j].index;
+            pos -= r - at;
+            sqlist_move::shift(data + at, data + r, data + pos);
+            r = at;
+            data[--pos] = std::move(ops_[j].value);
+        }
+        clear();
+    }
+
+    DynamicSqlist<Op> ops_;
+};
+
+
+#endif // SQLIST_EDIT_BATCH_H
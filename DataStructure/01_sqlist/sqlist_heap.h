@@ -0,0 +1,333 @@
+#ifndef SQLIST_HEAP_H
+#define SQLIST_HEAP_H
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "dynamic_sqlist.h"
+
+// 堆句柄 = 槽位下标 + 版本号，元素出堆后槽位版本号加一，旧句柄随之失效
+// 版本号为奇数表示槽位被占用，偶数表示空闲
+struct SqlistHeapHandle
+{
+    int index = -1;          // 槽位下标
+    unsigned generation = 0; // 版本号
+
+    bool operator==(const SqlistHeapHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SqlistHeapHandle& other) const { return !(*this == other); }
+};
+
+// D 叉堆（优先队列）
+// 下标为 i 的结点的孩子为 D*i+1 ... D*i+D，父结点为 (i-1)/D
+// Compare(a, b) 为真表示 a 应位于 b 之上，默认 std::less 即小根堆
+//
+// 缓存布局：元素单独紧密存放（句柄放在另一个平行数组中），数组按 64 字节对齐，并在根结点前空出 D-1 个位置，
+// 使结点 i 的孩子从 D*(i+1) 开始。D * sizeof(T) 整除 64 时（如 int 的 4 / 8 叉堆）
+// 每组兄弟恰好落在同一条缓存行内，下沉时每层只访问一条缓存行；D 越大树高越低。
+//
+// push 返回句柄，堆中元素移动时同步维护槽位到下标的映射，用于 decrease_key / get。
+// 句柄带版本号：元素出堆后旧句柄不再有效，contains 返回 false，不会误操作复用该槽位的新元素
+template <typename T, int D = 2, typename Compare = std::less<T>>
+class SqlistHeap
+{
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    using Handle = SqlistHeapHandle;
+
+    // 构造函数
+    SqlistHeap() = default;
+    explicit SqlistHeap(Compare comp) : comp_(comp) {}
+    template<typename InputIt>
+    SqlistHeap(InputIt first, InputIt last, Compare comp = Compare()) : comp_(comp) { heapify(first, last); }
+    ~SqlistHeap()
+    {
+        destroy_keys();
+        ::operator delete(buffer_);
+    }
+
+    // 拷贝和移动相关
+    SqlistHeap(const SqlistHeap& other)
+        : handles_(other.handles_), slots_(other.slots_), free_head_(other.free_head_), comp_(other.comp_)
+    {
+        grow(other.capacity_);
+        for (; size_ < other.size_; size_++) ::new (static_cast<void*>(keys_ + size_)) T(other.keys_[size_]);
+    }
+    SqlistHeap(SqlistHeap&& other) noexcept : comp_(other.comp_) { swap(other); }
+    SqlistHeap& operator=(SqlistHeap other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+    void swap(SqlistHeap& other) noexcept
+    {
+        std::swap(buffer_, other.buffer_);
+        std::swap(keys_, other.keys_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        handles_.swap(other.handles_);
+        slots_.swap(other.slots_);
+        std::swap(free_head_, other.free_head_);
+        std::swap(comp_, other.comp_);
+    }
+
+    // 入堆 O(log N)，返回句柄
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    Handle push(U&& x)
+    {
+        if (size_ >= capacity_) grow(capacity_ == 0 ? CACHE_LINE : capacity_ * 2);
+        int slot = acquire_slot();
+        ::new (static_cast<void*>(keys_ + size_)) T(std::forward<U>(x));
+        handles_.push_back(slot);
+        size_++;
+        sift_up(size_ - 1);
+        Handle handle;
+        handle.index = slot;
+        handle.generation = slots_[slot].generation;
+        return handle;
+    }
+
+    // 出堆 O(D log N / log D)
+    void pop()
+    {
+        if (size_ <= 0) return;
+        release_slot(handles_[0]);
+        int last = size_ - 1;
+        if (last > 0)
+        {
+            keys_[0] = std::move(keys_[last]);
+            handles_[0] = handles_[last];
+        }
+        keys_[last].~T();
+        handles_.pop_back();
+        size_--;
+        if (size_ > 1) sift_down(0);
+        else if (size_ == 1) slots_[handles_[0]].position = 0;
+    }
+
+    // 堆顶 O(1)
+    const T& top() const { return size_ ? keys_[0] : throw std::out_of_range("Heap is empty"); }
+    Handle top_handle() const
+    {
+        if (!size_) throw std::out_of_range("Heap is empty");
+        Handle handle;
+        handle.index = handles_[0];
+        handle.generation = slots_[handle.index].generation;
+        return handle;
+    }
+
+    // 批量建堆 O(N)，替换原有内容，原有句柄全部失效
+    // 需要句柄时传入 handles，按输入顺序依次追加每个元素的句柄
+    template<typename InputIt>
+    void heapify(InputIt first, InputIt last) { heapify_impl(first, last, nullptr); }
+    template<typename InputIt>
+    void heapify(InputIt first, InputIt last, DynamicSqlist<Handle>& handles) { heapify_impl(first, last, &handles); }
+    void heapify(std::initializer_list<T> init) { heapify(init.begin(), init.end()); }
+
+    // 把句柄对应元素改为优先级不低于原值的 x，然后上浮 O(log N)
+    // 句柄无效或 x 的优先级更低时返回 false
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U, T>::value>::type>
+    bool decrease_key(Handle handle, U&& x)
+    {
+        if (!contains(handle)) return false;
+        int index = slots_[handle.index].position;
+        if (comp_(keys_[index], x)) return false;
+        keys_[index] = std::forward<U>(x);
+        sift_up(index);
+        return true;
+    }
+
+    // 按句柄访问
+    bool contains(Handle handle) const noexcept
+    {
+        return handle.index >= 0 && handle.index < slots_.size() && slots_[handle.index].generation == handle.generation
+            && (handle.generation & 1u);
+    }
+    const T& get(Handle handle) const
+    {
+        if (!contains(handle)) throw std::out_of_range("Invalid heap handle");
+        return keys_[slots_[handle.index].position];
+    }
+
+    // 容量相关
+    int size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    // 清空 O(N)，槽位保留，所有旧句柄失效
+    // 空闲链表按槽位下标重新串起，之后入堆的元素按顺序取槽位，维护下标映射时访存更集中
+    void clear()
+    {
+        for (int i = 0; i < size_; i++) release_slot(handles_[i]);
+        destroy_keys();
+        size_ = 0;
+        if (!handles_.empty()) handles_.erase_range(0);
+        int slots = slots_.size();
+        for (int i = 0; i < slots; i++) slots_[i].position = i + 1 < slots ? i + 1 : -1;
+        free_head_ = slots ? 0 : -1;
+    }
+
+private:
+    static const int CACHE_LINE = 64;
+
+    struct Slot
+    {
+        int position = -1;       // 占用时为元素在堆数组中的下标，空闲时为下一个空闲槽位
+        unsigned generation = 0; // 版本号
+    };
+
+    // 取一个空闲槽位（没有时新建），版本号变为奇数
+    int acquire_slot()
+    {
+        int slot;
+        if (free_head_ >= 0)
+        {
+            slot = free_head_;
+            free_head_ = slots_[slot].position;
+        }
+        else
+        {
+            slot = slots_.size();
+            slots_.push_back(Slot());
+        }
+        slots_[slot].generation++;
+        return slot;
+    }
+    // 归还槽位，版本号变为偶数
+    void release_slot(int slot)
+    {
+        slots_[slot].generation++;
+        slots_[slot].position = free_head_;
+        free_head_ = slot;
+    }
+
+    template<typename InputIt>
+    void heapify_impl(InputIt first, InputIt last, DynamicSqlist<Handle>* handles)
+    {
+        clear();
+        int n = std::distance(first, last);
+        if (n > capacity_) grow(n);
+        handles_.reserve(n);
+        for (; first != last; ++first)
+        {
+            ::new (static_cast<void*>(keys_ + size_)) T(*first);
+            int slot = acquire_slot();
+            handles_.push_back(slot);
+            slots_[slot].position = size_;
+            size_++;
+            if (handles)
+            {
+                Handle handle;
+                handle.index = slot;
+                handle.generation = slots_[slot].generation;
+                handles->push_back(handle);
+            }
+        }
+        // n < 2 时已是堆；不能直接从 (n - 2) / D 开始，n == 0 时它向零取整为 0 而不是 -1
+        if (n < 2) return;
+        for (int i = (n - 2) / D; i >= 0; i--) sift_down(i);
+    }
+
+    // 重新分配元素数组：按缓存行对齐，根结点前空出 D-1 个位置
+    void grow(int capacity)
+    {
+        std::size_t bytes = sizeof(T) * (capacity + D - 1) + CACHE_LINE;
+        char* buffer = static_cast<char*>(::operator new(bytes));
+        std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(buffer) + CACHE_LINE - 1) & ~std::uintptr_t(CACHE_LINE - 1);
+        T* keys = reinterpret_cast<T*>(aligned) + (D - 1);
+        for (int i = 0; i < size_; i++)
+        {
+            ::new (static_cast<void*>(keys + i)) T(std::move(keys_[i]));
+            keys_[i].~T();
+        }
+        ::operator delete(buffer_);
+        buffer_ = buffer;
+        keys_ = keys;
+        capacity_ = capacity;
+    }
+    void destroy_keys()
+    {
+        for (int i = 0; i < size_; i++) keys_[i].~T();
+    }
+
+    // 上浮：父结点依次下移，最后把元素放入空位
+    void sift_up(int index)
+    {
+        T* a = keys_;
+        int* h = handles_.data();
+        T x = std::move(a[index]);
+        int xh = h[index];
+        while (index > 0)
+        {
+            int parent = (index - 1) / D;
+            if (!comp_(x, a[parent])) break;
+            a[index] = std::move(a[parent]);
+            h[index] = h[parent];
+            slots_[h[index]].position = index;
+            index = parent;
+        }
+        a[index] = std::move(x);
+        h[index] = xh;
+        slots_[xh].position = index;
+    }
+
+    // 下沉：在至多 D 个孩子中选出优先级最高的上移
+    void sift_down(int index)
+    {
+        T* a = keys_;
+        int* h = handles_.data();
+        int n = size_;
+        T x = std::move(a[index]);
+        int xh = h[index];
+        while (true)
+        {
+            int child = D * index + 1;
+            if (child >= n) break;
+            int best = child;
+            if (child + D <= n)
+            {
+                // 孩子满 D 个时循环次数固定，编译器可以展开
+                for (int c = 1; c < D; c++)
+                {
+                    if (comp_(a[child + c], a[best])) best = child + c;
+                }
+            }
+            else
+            {
+                for (int c = child + 1; c < n; c++)
+                {
+                    if (comp_(a[c], a[best])) best = c;
+                }
+            }
+            if (!comp_(a[best], x)) break;
+            a[index] = std::move(a[best]);
+            h[index] = h[best];
+            slots_[h[index]].position = index;
+            index = best;
+        }
+        a[index] = std::move(x);
+        h[index] = xh;
+        slots_[xh].position = index;
+    }
+
+    char* buffer_ = nullptr;          // 元素数组所在的原始内存
+    T* keys_ = nullptr;               // 堆数组，keys_ + D*(i+1) 按 64 字节对齐
+    int size_ = 0;                    // 元素个数
+    int capacity_ = 0;                // 元素数组容量
+    DynamicSqlist<int> handles_;      // 堆下标 -> 槽位，与 keys_ 平行
+    DynamicSqlist<Slot> slots_;       // 槽位：元素所在的堆下标与版本号
+    int free_head_ = -1;              // 空闲槽位链表头
+    Compare comp_;
+};
+
+// 常用的堆
+template<typename T, typename Compare = std::less<T>>
+using BinaryHeap = SqlistHeap<T, 2, Compare>;
+template<typename T, typename Compare = std::less<T>>
+using FourAryHeap = SqlistHeap<T, 4, Compare>;
+template<typename T, typename Compare = std::less<T>>
+using EightAryHeap = SqlistHeap<T, 8, Compare>;
+
+
+#endif // SQLIST_HEAP_H
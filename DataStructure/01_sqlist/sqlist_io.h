@@ -0,0 +1,342 @@
+#ifndef SQLIST_IO_H
+#define SQLIST_IO_H
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "static_sqlist.h"
+#include "dynamic_sqlist.h"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+// 浮点数的 from_chars / to_chars 需要 C++17 且标准库支持（libstdc++ 11 起）
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SQLIST_IO_FLOAT_CHARCONV 1
+#endif
+
+// 数值顺序表的批量文本读写
+// 读：整块读入内存后逐个解析（整数手写解析，浮点优先使用 std::from_chars），
+//     解析前按采样估算数字个数，动态顺序表 / std::vector 预先预留容量。
+// 写：整数手写格式化，浮点优先使用 std::to_chars，全部写入一块大缓冲区后整块输出。
+// 数字之间可用空白或逗号分隔
+//
+// 浮点数的文法与 std::from_chars 一致：可选的一个正负号（'+' 后不能再跟符号）、十进制小数或科学计数法、
+// inf / infinity / nan；不接受十六进制；溢出或非零值舍入为 0 时视为非法，非规格化数可以接受。
+// 没有 <charconv> 浮点支持时（例如 run.bat 的 -std=c++11）改用 strtof / strtod / strtold，
+// 先按上述文法把十六进制和超出范围的数拒绝掉，使两种编译方式接受的输入相同。该路径的限制：
+//   每个数字要拷贝到以 '\0' 结尾的缓冲区，明显慢于 from_chars；超过 63 个字符的数字会额外分配一次内存；
+//   strtod 按当前 C locale 识别小数点，这里会把 '.' 换成 locale 的小数点，并拒绝含 locale 小数点的输入，
+//   仅支持单字节小数点；输出使用 snprintf("%.*g")，同样随 locale 变化，且不是最短表示
+namespace sqlist_io
+{
+namespace detail
+{
+const int IO_BUFFER_SIZE = 1 << 20; // 输出缓冲区大小
+const int MAX_NUMBER_CHARS = 32;    // 单个数字格式化后的最大长度
+const int SAMPLE_SIZE = 1 << 20;    // 估算数字个数时采样的字节数
+
+// 空格及所有控制字符（换行、制表符等）和逗号都视为分隔符
+inline bool is_separator(char c) { return static_cast<unsigned char>(c) <= ' ' || c == ','; }
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+template<typename T>
+bool is_negative(T x, std::true_type /* signed */) { return x < 0; }
+template<typename T>
+bool is_negative(T, std::false_type) { return false; }
+
+// 数出 [first, last) 中的数字个数
+inline int count_tokens(const char* first, const char* last)
+{
+    // 无分支写法，统计“分隔符 -> 非分隔符”的次数
+    int count = 0;
+    int prev_sep = 1;
+    for (const char* p = first; p != last; ++p)
+    {
+        int sep = is_separator(*p);
+        count += prev_sep & (sep ^ 1);
+        prev_sep = sep;
+    }
+    return count;
+}
+
+// 估算数字个数，用于预留容量：只数开头 SAMPLE_SIZE 字节再按比例放大（多留 1/16 余量），
+// 避免为了预留容量把整个输入多扫一遍；估少了由顺序表自身扩容兜底
+inline int estimate_tokens(const char* first, const char* last)
+{
+    long long size = last - first;
+    if (size <= SAMPLE_SIZE) return count_tokens(first, last);
+    long long sampled = count_tokens(first, first + SAMPLE_SIZE);
+    long long estimate = sampled * size / SAMPLE_SIZE;
+    estimate += estimate / 16 + 1;
+    return estimate > std::numeric_limits<int>::max() ? std::numeric_limits<int>::max() : static_cast<int>(estimate);
+}
+
+// 解析整数，成功返回数字之后的位置，溢出或格式不对返回 nullptr
+template<typename T>
+const char* parse_value(const char* p, const char* last, T& out, std::true_type /* integral */)
+{
+    typedef typename std::make_unsigned<T>::type U;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        if (negative && !std::is_signed<T>::value) return nullptr;
+        ++p;
+    }
+    if (p == last || !is_digit(*p)) return nullptr;
+    // 前 digits10 位不可能溢出，不做检查；之后的每一位再检查
+    U value = 0;
+    const char* safe_end = last - p > std::numeric_limits<U>::digits10 ? p + std::numeric_limits<U>::digits10 : last;
+    for (; p != safe_end && is_digit(*p); ++p) value = value * 10 + static_cast<U>(*p - '0');
+    U limit = static_cast<U>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+    for (; p != last && is_digit(*p); ++p)
+    {
+        U digit = static_cast<U>(*p - '0');
+        if (value > (limit - digit) / 10) return nullptr;
+        value = value * 10 + digit;
+    }
+    out = static_cast<T>(negative ? U(0) - value : value);
+    return p;
+}
+
+#ifndef SQLIST_IO_FLOAT_CHARCONV
+// 按元素类型选择 strtof / strtod / strtold
+inline void str_to(const char* str, char** stop, float& out) { out = std::strtof(str, stop); }
+inline void str_to(const char* str, char** stop, double& out) { out = std::strtod(str, stop); }
+inline void str_to(const char* str, char** stop, long double& out) { out = std::strtold(str, stop); }
+
+// 用 strto* 解析以 '\0' 结尾的数字，十六进制、溢出以及非零值舍入为 0 时返回 false
+template<typename T>
+bool parse_c_string(const char* str, int& used, T& out)
+{
+    const char* digits = *str == '-' ? str + 1 : str;
+    if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) return false;
+    char* stop;
+    errno = 0;
+    str_to(str, &stop, out);
+    used = static_cast<int>(stop - str);
+    if (used == 0) return false;
+    // ERANGE 时 strto* 对非规格化数也会报告，只有结果为 0 或无穷时才是真正超出范围（与 from_chars 一致）
+    return errno != ERANGE || (out != 0 && !std::isinf(out));
+}
+#endif
+
+// 解析浮点数
+template<typename T>
+const char* parse_value(const char* p, const char* last, T& out, std::false_type)
+{
+    if (p != last && *p == '+')
+    {
+        ++p;
+        if (p != last && (*p == '+' || *p == '-')) return nullptr;
+    }
+#ifdef SQLIST_IO_FLOAT_CHARCONV
+    std::from_chars_result result = std::from_chars(p, last, out);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+    // strto* 需要以 '\0' 结尾，先把当前数字拷到局部缓冲区（过长时改用 std::string），
+    // 同时把 '.' 换成当前 locale 的小数点
+    const char point = *std::localeconv()->decimal_point ? *std::localeconv()->decimal_point : '.';
+    int len = 0;
+    while (p + len != last && !is_separator(p[len]))
+    {
+        if (point != '.' && p[len] == point) return nullptr;
+        len++;
+    }
+    char small[MAX_NUMBER_CHARS * 2];
+    std::string large;
+    char* token = small;
+    if (len >= static_cast<int>(sizeof(small)))
+    {
+        large.resize(len + 1);
+        token = &large[0];
+    }
+    for (int i = 0; i < len; i++) token[i] = p[i] == '.' ? point : p[i];
+    token[len] = '\0';
+    int used;
+    if (!parse_c_string(token, used, out)) return nullptr;
+    return p + used;
+#endif
+}
+
+// 两位数查表，一次写两个字符
+inline const char* digit_pairs()
+{
+    return "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+           "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+           "8081828384858687888990919293949596979899";
+}
+
+// 格式化整数，返回写入后的位置
+template<typename T>
+char* format_value(char* out, T x, std::true_type /* integral */)
+{
+    typedef typename std::make_unsigned<T>::type U;
+    U value = static_cast<U>(x);
+    if (is_negative(x, std::is_signed<T>()))
+    {
+        *out++ = '-';
+        value = U(0) - value;
+    }
+    char digits[MAX_NUMBER_CHARS];
+    char* p = digits + MAX_NUMBER_CHARS;
+    while (value >= 100)
+    {
+        const char* pair = digit_pairs() + (value % 100) * 2;
+        value /= 100;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+    if (value >= 10)
+    {
+        const char* pair = digit_pairs() + value * 2;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+    else
+    {
+        *--p = static_cast<char>('0' + value);
+    }
+    int len = static_cast<int>(digits + MAX_NUMBER_CHARS - p);
+    std::memcpy(out, p, len);
+    return out + len;
+}
+
+// 格式化浮点数：最短且可精确读回的表示
+template<typename T>
+char* format_value(char* out, T x, std::false_type)
+{
+#ifdef SQLIST_IO_FLOAT_CHARCONV
+    return std::to_chars(out, out + MAX_NUMBER_CHARS, x).ptr;
+#else
+    int len = std::snprintf(out, MAX_NUMBER_CHARS, "%.*g", std::numeric_limits<T>::max_digits10, static_cast<double>(x));
+    return out + len;
+#endif
+}
+
+// 预留容量：动态顺序表和 std::vector 预留，其余容器什么也不做
+template<typename List>
+void reserve_for(List&, int) {}
+template<typename T>
+void reserve_for(DynamicSqlist<T>& list, int count) { list.reserve(list.size() + count); }
+template<typename T>
+void reserve_for(std::vector<T>& list, int count) { list.reserve(list.size() + count); }
+
+// 追加一个元素，静态顺序表已满时返回 false
+template<typename List, typename T>
+bool append_value(List& list, T x)
+{
+    list.push_back(x);
+    return true;
+}
+template<typename T, int MAX_SIZE>
+bool append_value(StaticSqlist<T, MAX_SIZE>& list, T x) { return list.push_back(x); }
+
+// 把 list 格式化后分块交给 sink(const char*, int)
+template<typename List, typename Sink>
+bool format_all(const List& list, char sep, Sink sink)
+{
+    typedef typename std::decay<decltype(*list.begin())>::type T;
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "sqlist_io requires a numeric element type");
+    std::vector<char> buffer(IO_BUFFER_SIZE);
+    char* begin = buffer.data();
+    char* limit = begin + IO_BUFFER_SIZE - MAX_NUMBER_CHARS - 2;
+    char* out = begin;
+    bool first = true;
+    for (const auto& x : list)
+    {
+        if (out > limit)
+        {
+            if (!sink(begin, static_cast<int>(out - begin))) return false;
+            out = begin;
+        }
+        if (!first) *out++ = sep;
+        first = false;
+        out = format_value(out, x, std::integral_constant<bool, std::is_integral<T>::value>());
+    }
+    *out++ = '\n';
+    return sink(begin, static_cast<int>(out - begin));
+}
+} // namespace detail
+
+// 解析 [first, last) 中的所有数字并追加到 list
+// 遇到非法内容、溢出或静态顺序表已满时返回 false，此前解析的数字保留在 list 中
+template<typename List>
+bool parse_numbers(const char* first, const char* last, List& list)
+{
+    typedef typename std::decay<decltype(*list.begin())>::type T;
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "sqlist_io requires a numeric element type");
+    detail::reserve_for(list, detail::estimate_tokens(first, last));
+    const char* p = first;
+    while (true)
+    {
+        while (p != last && detail::is_separator(*p)) ++p;
+        if (p == last) return true;
+        T value;
+        p = detail::parse_value(p, last, value, std::integral_constant<bool, std::is_integral<T>::value>());
+        if (p == nullptr || (p != last && !detail::is_separator(*p))) return false;
+        if (!detail::append_value(list, value)) return false;
+    }
+}
+
+// 读取整个文件并解析，文件打不开时返回 false
+template<typename List>
+bool read_numbers(const char* path, List& list)
+{
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) return false;
+    // 按文件大小一次读入；取不到大小时分块读
+    std::vector<char> content;
+    long size = std::fseek(file, 0, SEEK_END) == 0 ? std::ftell(file) : -1;
+    if (size >= 0 && std::fseek(file, 0, SEEK_SET) == 0)
+    {
+        content.resize(static_cast<std::size_t>(size));
+        content.resize(std::fread(content.data(), 1, content.size(), file));
+    }
+    else
+    {
+        char chunk[1 << 16];
+        std::size_t n;
+        while ((n = std::fread(chunk, 1, sizeof(chunk), file)) > 0) content.insert(content.end(), chunk, chunk + n);
+    }
+    std::fclose(file);
+    return parse_numbers(content.data(), content.data() + content.size(), list);
+}
+
+// 以 sep 分隔写出所有数字，末尾换行
+template<typename List>
+bool write_numbers(std::FILE* file, const List& list, char sep = ' ')
+{
+    return detail::format_all(list, sep, [file](const char* data, int len) {
+        return std::fwrite(data, 1, len, file) == static_cast<std::size_t>(len);
+    });
+}
+template<typename List>
+bool write_numbers(std::ostream& os, const List& list, char sep = ' ')
+{
+    return detail::format_all(list, sep, [&os](const char* data, int len) {
+        return static_cast<bool>(os.write(data, len));
+    });
+}
+template<typename List>
+bool write_numbers(const char* path, const List& list, char sep = ' ')
+{
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) return false;
+    bool ok = write_numbers(file, list, sep);
+    return std::fclose(file) == 0 && ok;
+}
+} // namespace sqlist_io
+
+
+#endif // SQLIST_IO_H
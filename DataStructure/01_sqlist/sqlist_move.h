@@ -0,0 +1,37 @@
+#ifndef SQLIST_MOVE_H
+#define SQLIST_MOVE_H
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// 顺序表元素整体搬移
+// 插入 / 删除时把 [first, last) 搬到 d_first 开始的位置，两段可以重叠。
+// 可平凡复制的类型直接一次 memmove；其余类型按方向逐个 std::move，
+// 向后搬（插入）时从尾部开始，避免覆盖尚未搬走的元素
+namespace sqlist_move
+{
+namespace detail
+{
+template<typename T>
+void shift(T* first, T* last, T* d_first, std::true_type /* trivially copyable */)
+{
+    if (first != last && first != d_first) std::memmove(d_first, first, (last - first) * sizeof(T));
+}
+template<typename T>
+void shift(T* first, T* last, T* d_first, std::false_type)
+{
+    if (d_first < first) std::move(first, last, d_first);
+    else if (d_first > first) std::move_backward(first, last, d_first + (last - first));
+}
+} // namespace detail
+
+template<typename T>
+void shift(T* first, T* last, T* d_first)
+{
+    detail::shift(first, last, d_first, std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+}
+} // namespace sqlist_move
+
+
+#endif // SQLIST_MOVE_H
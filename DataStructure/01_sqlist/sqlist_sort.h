@@ -0,0 +1,422 @@
+#ifndef SQLIST_SORT_H
+#define SQLIST_SORT_H
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 顺序表排序引擎，作用于连续存储 [first, last)
+//   sort           整数 / 浮点（默认比较）使用 LSD 基数排序 O(N)，其余使用 pdqsort 风格的内省排序 O(N log N)
+//   stable_sort    整数使用基数排序（本身稳定），其余（包括浮点）使用归并排序
+//   parallel_sort  多线程归并排序（稳定），适合超大顺序表
+// 浮点基数排序按位模式排序：-0.0 排在 +0.0 之前，NaN 按符号位排在两端。
+// std::less 认为 -0.0 与 +0.0 相等，按位模式排序会打乱它们的相对顺序，因此浮点的稳定排序不走基数排序
+namespace sqlist_sort
+{
+namespace detail
+{
+const int INSERTION_SORT_THRESHOLD = 24;    // 小区间改用插入排序
+const int NINTHER_THRESHOLD = 128;          // 大区间用九数取中选枢轴
+const int PARTIAL_INSERTION_LIMIT = 8;      // 疑似有序时插入排序允许的最多搬移次数
+const int RADIX_SORT_THRESHOLD = 256;       // 元素太少时基数排序的计数开销不划算
+const int PARALLEL_SORT_THRESHOLD = 1 << 16; // 每个线程至少分到的元素个数
+
+// 插入排序 O(N^2)，稳定
+template<typename T, typename Compare>
+void insertion_sort(T* first, T* last, Compare comp)
+{
+    if (first == last) return;
+    for (T* cur = first + 1; cur != last; ++cur)
+    {
+        if (!comp(*cur, *(cur - 1))) continue;
+        T tmp = std::move(*cur);
+        T* hole = cur;
+        do
+        {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        } while (hole != first && comp(tmp, *(hole - 1)));
+        *hole = std::move(tmp);
+    }
+}
+
+// 插入排序，搬移次数超过上限就放弃，返回是否已排好
+template<typename T, typename Compare>
+bool partial_insertion_sort(T* first, T* last, Compare comp)
+{
+    if (first == last) return true;
+    int moves = 0;
+    for (T* cur = first + 1; cur != last; ++cur)
+    {
+        if (!comp(*cur, *(cur - 1))) continue;
+        T tmp = std::move(*cur);
+        T* hole = cur;
+        do
+        {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        } while (hole != first && comp(tmp, *(hole - 1)));
+        *hole = std::move(tmp);
+        moves += cur - hole;
+        if (moves > PARTIAL_INSERTION_LIMIT) return false;
+    }
+    return true;
+}
+
+// 使 *a <= *b <= *c
+template<typename T, typename Compare>
+void sort3(T* a, T* b, T* c, Compare comp)
+{
+    if (comp(*b, *a)) std::iter_swap(a, b);
+    if (comp(*c, *b)) std::iter_swap(b, c);
+    if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+// 以 *first 为枢轴划分：左边 < 枢轴，右边 >= 枢轴
+// 返回枢轴最终位置，以及划分前是否已经有序（没有发生交换）
+// 调用前需保证区间末尾存在 >= 枢轴的元素（三数取中保证）
+template<typename T, typename Compare>
+std::pair<T*, bool> partition_right(T* first, T* last, Compare comp)
+{
+    const T& pivot = *first;
+    T* f = first;
+    T* l = last;
+    while (comp(*++f, pivot));
+    if (f - 1 == first) while (f < l && !comp(*--l, pivot));
+    else while (!comp(*--l, pivot));
+
+    bool already_partitioned = f >= l;
+    while (f < l)
+    {
+        std::iter_swap(f, l);
+        while (comp(*++f, pivot));
+        while (!comp(*--l, pivot));
+    }
+    T* pivot_pos = f - 1;
+    std::iter_swap(first, pivot_pos);
+    return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// 以 *first 为枢轴划分：左边 <= 枢轴，右边 > 枢轴
+// 用于大量重复元素：等于枢轴的元素一次性归到左边，不再参与后续递归
+template<typename T, typename Compare>
+T* partition_left(T* first, T* last, Compare comp)
+{
+    const T& pivot = *first;
+    T* f = first;
+    T* l = last;
+    while (comp(pivot, *--l));
+    if (l + 1 == last) while (f < l && !comp(pivot, *++f));
+    else while (!comp(pivot, *++f));
+
+    while (f < l)
+    {
+        std::iter_swap(f, l);
+        while (comp(pivot, *--l));
+        while (!comp(pivot, *++f));
+    }
+    std::iter_swap(first, l);
+    return l;
+}
+
+// pdqsort 主循环
+// bad_allowed: 允许的严重不平衡划分次数，用完后退化为堆排序，保证 O(N log N)
+// leftmost:    区间左侧没有元素，否则 *(first - 1) 不大于区间内任何元素
+template<typename T, typename Compare>
+void pdqsort_loop(T* first, T* last, Compare comp, int bad_allowed, bool leftmost)
+{
+    while (true)
+    {
+        int size = last - first;
+        if (size < INSERTION_SORT_THRESHOLD)
+        {
+            insertion_sort(first, last, comp);
+            return;
+        }
+
+        // 选枢轴并放到 *first
+        int half = size / 2;
+        if (size > NINTHER_THRESHOLD)
+        {
+            sort3(first, first + half, last - 1, comp);
+            sort3(first + 1, first + (half - 1), last - 2, comp);
+            sort3(first + 2, first + (half + 1), last - 3, comp);
+            sort3(first + (half - 1), first + half, first + (half + 1), comp);
+            std::iter_swap(first, first + half);
+        }
+        else
+        {
+            sort3(first + half, first, last - 1, comp);
+        }
+
+        // 枢轴与左侧相邻元素相等：区间内没有比它小的元素，把等于枢轴的元素全部归到左边
+        if (!leftmost && !comp(*(first - 1), *first))
+        {
+            first = partition_left(first, last, comp) + 1;
+            continue;
+        }
+
+        std::pair<T*, bool> result = partition_right(first, last, comp);
+        T* pivot_pos = result.first;
+        int l_size = pivot_pos - first;
+        int r_size = last - (pivot_pos + 1);
+
+        if (l_size < size / 8 || r_size < size / 8)
+        {
+            // 划分严重不平衡：次数用完改用堆排序，否则打乱部分元素破坏不利模式
+            if (--bad_allowed == 0)
+            {
+                std::make_heap(first, last, comp);
+                std::sort_heap(first, last, comp);
+                return;
+            }
+            if (l_size >= INSERTION_SORT_THRESHOLD)
+            {
+                std::iter_swap(first, first + l_size / 4);
+                std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+            }
+            if (r_size >= INSERTION_SORT_THRESHOLD)
+            {
+                std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                std::iter_swap(last - 1, last - r_size / 4);
+            }
+        }
+        else if (result.second
+            && partial_insertion_sort(first, pivot_pos, comp)
+            && partial_insertion_sort(pivot_pos + 1, last, comp))
+        {
+            // 划分时没有交换且两边都接近有序，直接结束
+            return;
+        }
+
+        // 递归处理左边，循环处理右边
+        pdqsort_loop(first, pivot_pos, comp, bad_allowed, leftmost);
+        first = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template<typename T, typename Compare>
+void pdqsort(T* first, T* last, Compare comp)
+{
+    int size = last - first;
+    if (size < 2) return;
+    int log2 = 0;
+    while (size >>= 1) log2++;
+    pdqsort_loop(first, last, comp, log2 + 1, true);
+}
+
+// 基数排序的键：把元素映射成无符号整数，使无符号比较的顺序与原值一致
+template<typename T, typename = void>
+struct radix_key
+{
+    static const bool enabled = false;
+};
+template<typename T>
+struct radix_key<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static const bool enabled = true;
+    typedef typename std::make_unsigned<T>::type type;
+    static type get(T x)
+    {
+        // 有符号整数翻转符号位
+        const type sign = std::is_signed<T>::value ? type(type(1) << (sizeof(T) * 8 - 1)) : type(0);
+        return static_cast<type>(x) ^ sign;
+    }
+};
+template<typename T>
+struct radix_key<T, typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value>::type>
+{
+    static const bool enabled = true;
+    typedef typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type type;
+    static type get(T x)
+    {
+        // 负数全部取反，非负数翻转符号位
+        type bits;
+        std::memcpy(&bits, &x, sizeof(T));
+        const type sign = type(1) << (sizeof(T) * 8 - 1);
+        return (bits & sign) ? ~bits : (bits | sign);
+    }
+};
+
+// LSD 基数排序 O(N)，稳定，每趟处理 8 位
+// 一趟统计出所有位上的计数，某一位上所有元素相同时跳过该趟
+template<typename T>
+void radix_sort(T* first, T* last)
+{
+    typedef radix_key<T> Key;
+    const int PASSES = sizeof(typename Key::type);
+    int n = last - first;
+    if (n < 2) return;
+
+    static_assert(PASSES <= 8, "radix key too wide");
+    int counts[PASSES][256];
+    std::memset(counts, 0, sizeof(counts));
+    for (T* p = first; p != last; ++p)
+    {
+        typename Key::type key = Key::get(*p);
+        for (int b = 0; b < PASSES; b++) counts[b][(key >> (b * 8)) & 0xFF]++;
+    }
+
+    std::vector<T> buffer(n);
+    T* src = first;
+    T* dst = buffer.data();
+    for (int b = 0; b < PASSES; b++)
+    {
+        int* count = counts[b];
+        if (count[(Key::get(*src) >> (b * 8)) & 0xFF] == n) continue;
+        int offset = 0;
+        for (int d = 0; d < 256; d++)
+        {
+            int c = count[d];
+            count[d] = offset;
+            offset += c;
+        }
+        for (T* p = src; p != src + n; ++p)
+        {
+            dst[count[(Key::get(*p) >> (b * 8)) & 0xFF]++] = std::move(*p);
+        }
+        std::swap(src, dst);
+    }
+    if (src != first) std::move(src, src + n, first);
+}
+
+// 原地归并相邻的有序段 [first, mid) 和 [mid, last)，左段先搬到 buffer
+// 左段取完后右段剩余元素已在原位，不需要再搬（std::merge 不允许输出与输入重叠）
+template<typename T, typename Compare>
+void merge_with_buffer(T* first, T* mid, T* last, T* buffer, Compare comp)
+{
+    T* left = buffer;
+    T* left_end = std::move(first, mid, buffer);
+    T* right = mid;
+    T* out = first;
+    while (left != left_end && right != last)
+    {
+        if (comp(*right, *left)) *out++ = std::move(*right++);
+        else *out++ = std::move(*left++);
+    }
+    std::move(left, left_end, out);
+}
+
+// 归并排序 O(N log N)，稳定，buffer 至少能容纳 last - first 个元素
+template<typename T, typename Compare>
+void merge_sort(T* first, T* last, T* buffer, Compare comp)
+{
+    int size = last - first;
+    if (size <= INSERTION_SORT_THRESHOLD)
+    {
+        insertion_sort(first, last, comp);
+        return;
+    }
+    T* mid = first + size / 2;
+    merge_sort(first, mid, buffer, comp);
+    merge_sort(mid, last, buffer, comp);
+    if (!comp(*mid, *(mid - 1))) return; // 两段已经首尾有序
+    merge_with_buffer(first, mid, last, buffer, comp);
+}
+
+// 多线程归并排序：左半交给新线程，右半在当前线程，depth 为剩余的拆分层数
+template<typename T, typename Compare>
+void parallel_merge_sort(T* first, T* last, T* buffer, Compare comp, int depth)
+{
+    int size = last - first;
+    if (depth <= 0 || size < 2 * PARALLEL_SORT_THRESHOLD)
+    {
+        merge_sort(first, last, buffer, comp);
+        return;
+    }
+    T* mid = first + size / 2;
+    std::thread left(parallel_merge_sort<T, Compare>, first, mid, buffer, comp, depth - 1);
+    parallel_merge_sort(mid, last, buffer + (mid - first), comp, depth - 1);
+    left.join();
+    if (!comp(*mid, *(mid - 1))) return;
+    merge_with_buffer(first, mid, last, buffer, comp);
+}
+
+template<typename T>
+void sort_default(T* first, T* last, std::true_type /* radix */)
+{
+    if (last - first < RADIX_SORT_THRESHOLD) pdqsort(first, last, std::less<T>());
+    else if (!std::is_sorted(first, last)) radix_sort(first, last); // 已有序时扫描一遍即可返回
+}
+template<typename T>
+void sort_default(T* first, T* last, std::false_type)
+{
+    pdqsort(first, last, std::less<T>());
+}
+
+template<typename T, typename Compare>
+void stable_sort_impl(T* first, T* last, Compare comp)
+{
+    int size = last - first;
+    if (size <= INSERTION_SORT_THRESHOLD)
+    {
+        insertion_sort(first, last, comp);
+        return;
+    }
+    std::vector<T> buffer(size / 2);
+    merge_sort(first, last, buffer.data(), comp);
+}
+template<typename T>
+void stable_sort_default(T* first, T* last, std::true_type /* radix */)
+{
+    if (last - first < RADIX_SORT_THRESHOLD) stable_sort_impl(first, last, std::less<T>());
+    else if (!std::is_sorted(first, last)) radix_sort(first, last);
+}
+template<typename T>
+void stable_sort_default(T* first, T* last, std::false_type)
+{
+    stable_sort_impl(first, last, std::less<T>());
+}
+} // namespace detail
+
+// 不稳定排序，默认升序
+template<typename T>
+void sort(T* first, T* last)
+{
+    detail::sort_default(first, last, std::integral_constant<bool, detail::radix_key<T>::enabled>());
+}
+template<typename T>
+void sort(T* first, T* last, std::less<T>) { sort(first, last); }
+template<typename T, typename Compare>
+void sort(T* first, T* last, Compare comp) { detail::pdqsort(first, last, comp); }
+
+// 稳定排序，默认升序
+template<typename T>
+void stable_sort(T* first, T* last)
+{
+    detail::stable_sort_default(first, last,
+        std::integral_constant<bool, detail::radix_key<T>::enabled && std::is_integral<T>::value>());
+}
+template<typename T>
+void stable_sort(T* first, T* last, std::less<T>) { stable_sort(first, last); }
+template<typename T, typename Compare>
+void stable_sort(T* first, T* last, Compare comp) { detail::stable_sort_impl(first, last, comp); }
+
+// 多线程归并排序，稳定；threads <= 0 时使用硬件线程数
+// 比较函数不能抛出异常（在子线程中抛出会直接终止程序）
+template<typename T, typename Compare>
+void parallel_sort(T* first, T* last, Compare comp, int threads = 0)
+{
+    int size = last - first;
+    if (threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (threads <= 1 || size < 2 * detail::PARALLEL_SORT_THRESHOLD)
+    {
+        stable_sort(first, last, comp);
+        return;
+    }
+    int depth = 0;
+    while ((1 << (depth + 1)) <= threads) depth++;
+    std::vector<T> buffer(size);
+    detail::parallel_merge_sort(first, last, buffer.data(), comp, depth);
+}
+template<typename T>
+void parallel_sort(T* first, T* last, int threads = 0) { parallel_sort(first, last, std::less<T>(), threads); }
+} // namespace sqlist_sort
+
+
+#endif // SQLIST_SORT_H
@@ -0,0 +1,72 @@
+#ifndef SQLIST_SPAN_H
+#define SQLIST_SPAN_H
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// 连续存储的非拥有视图（不拷贝、不释放）
+// 可以从原始指针、C 数组，以及任何提供 data() / size() 的连续容器构造：
+// DynamicSqlist、StaticSqlist、std::vector、std::array 等。
+// 视图只借用底层数组，容器扩容、移动或析构后视图失效。
+// SqlistSpan<const T> 也可以绑定临时容器，此时视图只在该完整表达式内有效，适合直接作为函数参数。
+// SqlistSpan<T> 可隐式转换为 SqlistSpan<const T>
+template <typename T>
+class SqlistSpan
+{
+public:
+    // 构造函数
+    SqlistSpan() = default;
+    SqlistSpan(T* data, int size) : data_(data), size_(size) {}
+    SqlistSpan(T* first, T* last) : data_(first), size_(static_cast<int>(last - first)) {}
+    template<int N>
+    SqlistSpan(T (&arr)[N]) : data_(arr), size_(N) {}
+    template<typename Container, typename = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<Container&>().data()), T*>::value>::type>
+    SqlistSpan(Container& c) : data_(c.data()), size_(static_cast<int>(c.size())) {}
+    template<typename Container, typename = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<const Container&>().data()), T*>::value>::type>
+    SqlistSpan(const Container& c) : data_(c.data()), size_(static_cast<int>(c.size())) {}
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>
+    SqlistSpan(const SqlistSpan<U>& other) : data_(other.data()), size_(other.size()) {}
+
+    // 容量相关
+    T* data() const noexcept { return data_; }
+    int size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    // 访问元素 O(1)
+    T& operator[](int index) const { return data_[index]; }
+    T& at(int index) const
+    {
+        if (index < 0 || index >= size_) throw std::out_of_range("Index out of bounds");
+        return data_[index];
+    }
+    T& front() const { return size_ ? data_[0] : throw std::out_of_range("Span is empty"); }
+    T& back() const { return size_ ? data_[size_ - 1] : throw std::out_of_range("Span is empty"); }
+
+    // 子视图 O(1)，len == -1 表示到末尾，越界时截断
+    SqlistSpan subspan(int offset, int len = -1) const
+    {
+        if (offset < 0) offset = 0;
+        if (offset > size_) offset = size_;
+        if (len < 0 || len > size_ - offset) len = size_ - offset;
+        return SqlistSpan(data_ + offset, len);
+    }
+    SqlistSpan first(int len) const { return subspan(0, len); }
+    SqlistSpan last(int len) const { return subspan(len < size_ ? size_ - len : 0); }
+
+    // 迭代器
+    T* begin() const noexcept { return data_; }
+    T* end() const noexcept { return data_ + size_; }
+    using reverse_iterator = std::reverse_iterator<T*>;
+    reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+private:
+    T* data_ = nullptr; // 借用的数组首地址
+    int size_ = 0; // 元素个数
+};
+
+
+#endif // SQLIST_SPAN_H
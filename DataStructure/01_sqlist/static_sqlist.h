@@ -2,6 +2,9 @@
 #define STATIC_SQLIST_H
 #include <iterator>
 #include <initializer_list>
+#include "sqlist_sort.h"
+#include "sqlist_move.h"
+#include "sqlist_span.h"
 
 template<typename T, int MAX_SIZE>
 
@@ -31,7 +34,7 @@ public:
     bool push_front(U&& x)
     {
         if (size_ >= MAX_SIZE) return false;
-        for(int i = size_; i > 0; i--) data_[i] = std::move(data_[i - 1]);
+        sqlist_move::shift(data_, data_ + size_, data_ + 1);
         data_[0] = std::forward<U>(x);
         size_++;
         return true;
@@ -41,7 +44,7 @@ public:
     bool insert(int pos, U&& x)
     {
         if (size_ >= MAX_SIZE || pos < 0 || pos > size_) return false;
-        for(int i = size_; i > pos; i--) data_[i] = std::move(data_[i - 1]);
+        sqlist_move::shift(data_ + pos, data_ + size_, data_ + pos + 1);
         data_[pos] = std::forward<U>(x); size_++;
         return true;
     }
@@ -56,7 +59,7 @@ public:
     bool pop_front()
     {
         if (size_ == 0) return false;
-        for(int i = 1; i < size_; i++) data_[i - 1] = std::move(data_[i]);
+        sqlist_move::shift(data_ + 1, data_ + size_, data_);
         size_--;
         return true;
     }
@@ -64,10 +67,7 @@ public:
     bool erase(int index)
     {
         if (index < 0 || index >= size_) return false;
-        for(int i = index + 1; i < size_; i++)
-        {
-            data_[i - 1] = std::move(data_[i]);
-        }
+        sqlist_move::shift(data_ + index + 1, data_ + size_, data_ + index);
         size_--;
         return true;
     }
@@ -130,7 +130,7 @@ public:
     {
         int len = std::distance(first, last);
         if (size_ + len > MAX_SIZE || index < 0 || index > size_) return false;
-        for (int i = size_ - 1; i >= index; i--) data_[i + len] = std::move(data_[i]);
+        sqlist_move::shift(data_ + index, data_ + size_, data_ + index + len);
         std::copy(first, last, data_ + index);
         size_ += len;
         return true;
@@ -138,6 +138,7 @@ public:
     bool insert_range(int index, std::initializer_list<T> init) { return insert_range(index, init.begin(), init.end()); }
     bool insert_range(int index, const StaticSqlist& other) { return insert_range(index, other.begin(), other.end()); }
     bool insert_range(int index, const T* arr, int len) { return insert_range(index, arr, arr + len); }
+    bool insert_range(int index, SqlistSpan<const T> span) { return insert_range(index, span.begin(), span.end()); }
     // 批量添加 O(N)
     template<typename InputIt>
     bool append(InputIt first, InputIt last)
@@ -151,17 +152,33 @@ public:
     bool append(std::initializer_list<T> init) { return append(init.begin(), init.end()); }
     bool append(const StaticSqlist& other) { return append(other.begin(), other.end()); }
     bool append(const T* arr, int len) { return append(arr, arr + len); }
+    // 整段拷贝，容量不足时不添加任何元素
+    bool append(SqlistSpan<const T> span) { return insert_range(size_, span.begin(), span.end()); }
     // 批量删除 O(N)
     bool erase_range(int index, int len = -1)
     {
         if (len == -1) len = size_ - index;
         if (index < 0 || index >= size_ || len <= 0 || index + len > size_) return false;
-        for (int i = index + len; i < size_; i++) data_[i - len] = std::move(data_[i]);
+        sqlist_move::shift(data_ + index + len, data_ + size_, data_ + index);
         size_ -= len;
         return true;
     }
     bool remove_range(int index, int len) { return erase_range(index, len); }
 
+    // 排序，默认升序
+    // 整数 / 浮点使用基数排序 O(N)，其余类型使用内省排序 O(N log N)
+    void sort() { sqlist_sort::sort(begin(), end()); }
+    template<typename Compare>
+    void sort(Compare comp) { sqlist_sort::sort(begin(), end(), comp); }
+    // 稳定排序
+    void stable_sort() { sqlist_sort::stable_sort(begin(), end()); }
+    template<typename Compare>
+    void stable_sort(Compare comp) { sqlist_sort::stable_sort(begin(), end(), comp); }
+    // 多线程稳定排序，适合超大顺序表，threads <= 0 时使用硬件线程数
+    void parallel_sort(int threads = 0) { sqlist_sort::parallel_sort(begin(), end(), threads); }
+    template<typename Compare>
+    void parallel_sort(Compare comp, int threads = 0) { sqlist_sort::parallel_sort(begin(), end(), comp, threads); }
+
     // 清空操作 O(1)
     void clear() { size_ = 0; }
 
@@ -170,6 +187,10 @@ public:
     bool empty() const noexcept { return size_ == 0; }
     int capacity() const noexcept { return MAX_SIZE; }
 
+    // 非拥有视图 O(1)
+    SqlistSpan<T> span() { return SqlistSpan<T>(data_, size_); }
+    SqlistSpan<const T> span() const { return SqlistSpan<const T>(data_, size_); }
+
     // 交换容器 O(N)
     void swap(StaticSqlist& other)
     {
@@ -188,6 +209,8 @@ public:
     friend void swap(StaticSqlist& a, StaticSqlist& b) noexcept { a.swap(b); }
 
     // 迭代器
+    T* data() { return data_; }
+    const T* data() const { return data_; }
     T* begin() { return data_; }
     T* end() { return data_ + size_; }
     const T* begin() const { return data_; }